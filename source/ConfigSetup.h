@@ -14,6 +14,7 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(GRID_Y, int, 100, "Height of world, just multiplied by width to get total size"),
     VALUE(POP_SIZE, int, -1, "Starting size of the host population, -1 for full starting population"),
     VALUE(SYM_LIMIT, int, 1, "Number of symbiont allowed to infect a single host"),
+    VALUE(SYM_SWAP_REMOVE, bool, 0, "Should a symbiont that dies in its host be replaced by the host's last symbiont instead of shifting the rest down? Faster with many symbionts per host, but changes the order symbionts are processed in (0 for no, 1 for yes)"),
     VALUE(START_MOI, double, 1, "Ratio of symbionts to hosts that experiment should start with"),
     VALUE(UPDATES, int, 1001, "Number of updates to run before quitting"),
     VALUE(RES_DISTRIBUTE, int, 100, "Number of resources to give to each host each update if they are available"),
@@ -24,12 +25,22 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(SYM_HORIZ_TRANS_RES, double, 100, "How many resources required for symbiont non-lytic horizontal transmission"),
     VALUE(SYM_VERT_TRANS_RES, double, 0, "How many resources required for symbiont vertical transmission"),
     VALUE(GRID, bool, 0, "Do offspring get placed immediately next to parents on grid, same for symbiont spreading"),
+    VALUE(GRID_TOPOLOGY, std::string, "moore", "Shape of the neighborhoods on the grid: moore (square cells, including diagonals), von_neumann (square cells, no diagonals) or hex (hexagonal cells)"),
+    VALUE(GRID_RADIUS, int, 1, "How many cells away from an organism its grid neighborhood reaches"),
+    VALUE(GRID_WRAP, bool, 1, "Does the grid wrap around at its edges? (0 for no, 1 for yes)"),
+    VALUE(DISPERSAL_KERNEL, std::string, "neighbor", "If grid is on, where do host offspring and moving free-living symbionts land? neighbor (a random cell of the neighborhood), exponential or power_law (a random distance, weighted by the kernel)"),
+    VALUE(DISPERSAL_SCALE, double, 2, "Length scale in cells of the exponential dispersal kernel"),
+    VALUE(DISPERSAL_EXPONENT, double, 3, "Exponent of the power law dispersal kernel"),
+    VALUE(DISPERSAL_MAX_DIST, int, 10, "Farthest distance in cells that the exponential and power law dispersal kernels reach"),
     VALUE(SYM_INFECTION_CHANCE, double, 1, "The chance (between 0 and 1) that a sym will infect a parallel host on process"),
     VALUE(SYM_INFECTION_FAILURE_RATE, double, 0, "The chance (between 0 and 1) that a sym will be killed by the world while trying to infect a host"),
     VALUE(HOST_AGE_MAX, int, -1, "The maximum number of updates hosts are allowed to live, -1 for infinite"),
     VALUE(SYM_AGE_MAX, int, -1, "The maximum updates symbionts are allowed to live, -1 for infinite"),
     VALUE(PHYLOGENY, bool, 0, "Should the world keep track of host and symbiont phylogenies? (0 for no, 1 for yes)"),
     VALUE(NUM_PHYLO_BINS, size_t, 5, "How many bins should organisms be sepeated into if phylogeny is on?"),
+    VALUE(PHYLOGENY_TRACKER, std::string, "full", "If phylogeny is on, how should it be tracked? full (a taxon for every change of bin along a lineage), binned (a single taxon per bin, much faster) or lineage (a compact tree of interaction value genotypes, pruned of extinct lineages)"),
+    VALUE(PHYLOGENY_PRUNE_INT, int, 100, "If PHYLOGENY_TRACKER is lineage, how often, in updates, should extinct lineages be pruned?"),
+    VALUE(GENOTYPE_TABLE, bool, 0, "Should the world keep a table of the host and symbiont genotypes (their trait values) with the number of organisms of each? (0 for no, 1 for yes)"),
     VALUE(NO_MUT_UPDATES, int, 0, "How many updates should be run after the end of UPDATES with all mutation turned off?"),
     VALUE(FILE_PATH, std::string, "", "Output file path"),
     VALUE(FILE_NAME, std::string, "_data", "Root output file name"),
@@ -76,6 +87,19 @@ EMP_BUILD_CONFIG(SymConfigBase,
     VALUE(EFFICIENT_SYM, bool, 0, "Do you want symbionts that also have an efficiency value that evolves"),
     VALUE(COMPETITION_MODE, bool, 0, "Should a competition between two types be conducted? (Which is specified in the code)"),
 
+    GROUP(DATA, "Settings for data output"),
+    VALUE(DATA_MANIFEST, std::string, "all", "Comma separated list of data files (e.g. HostVals) and columns (e.g. HostVals:count, HostVals:Hist) to write, or all"),
+    VALUE(DELTA_ENCODE_DATA, bool, 0, "Should data rows only record the columns that changed since the previous row? Decode with symbulation_extract (0 for no, 1 for yes)"),
+    VALUE(ADAPTIVE_DATA, bool, 0, "Should data print more often than DATA_INT while the population is changing? DATA_INT becomes the longest gap between rows (0 for no, 1 for yes)"),
+    VALUE(ADAPTIVE_MIN_INT, int, 1, "If ADAPTIVE_DATA is on, the fewest updates allowed between rows"),
+    VALUE(ADAPTIVE_EVENT_WINDOW, int, 100, "If ADAPTIVE_DATA is on, how many updates to print every ADAPTIVE_MIN_INT updates after hosts or symbionts go extinct"),
+    VALUE(ADAPTIVE_COUNT_CHANGE, double, 0.05, "If ADAPTIVE_DATA is on, the relative change in host or symbiont count since the last row that triggers a new row"),
+    VALUE(ADAPTIVE_INTVAL_CHANGE, double, 0.02, "If ADAPTIVE_DATA is on, the change in mean host or symbiont interaction value since the last row that triggers a new row"),
+    VALUE(ADAPTIVE_HIST_CHANGE, double, 0.05, "If ADAPTIVE_DATA is on, the distance (0 to 1) between interaction value histograms since the last row that triggers a new row"),
+    VALUE(SINGLE_DATA_STREAM, bool, 0, "Should all data files of a run be written as series of one record stream? Split with symbulation_extract (0 for no, 1 for yes)"),
+    VALUE(CENSUS_DATA, bool, 0, "Should a Census file record live organism objects, births and deletions of each type, bytes held by symbiont lists and peak memory? (0 for no, 1 for yes)"),
+    VALUE(DIGEST_INT, int, 0, "How often, in updates, should a digest of the whole world state be written to a StateDigest file for comparing builds? (0 for never)"),
+
 
 )
 #endif
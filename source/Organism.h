@@ -5,6 +5,9 @@
 #include <limits>
 #include <emp/Evolve/Systematics.hpp>
 #include "ConfigSetup.h"
+#include "default_mode/StateHasher.h"
+#include "default_mode/SymList.h"
+#include "default_mode/GenotypeTable.h"
 
 class Organism {
 
@@ -93,6 +96,12 @@ class Organism {
   virtual double ProcessResources(double sym_piece, emp::Ptr<Organism> host){
     std::cout << "ProcessResources called from an Organism" << std::endl;
     throw "Organism method called!";}
+  virtual bool HasDefaultResourceProcessing(){
+    std::cout << "HasDefaultResourceProcessing called from an Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void GetPayoff(double host_int_val, double sym_piece, double synergy, double & host_gain, double & sym_gain){
+    std::cout << "GetPayoff called from an Organism" << std::endl;
+    throw "Organism method called!";}
   virtual bool IsPhage(){
     std::cout << "IsPhage called from an Organism" << std::endl;
     throw "Organism method called!";}
@@ -117,6 +126,24 @@ class Organism {
   virtual void SetTaxon(emp::Ptr<emp::Taxon<int>> _in) {
     std::cout << "SetTaxon called from an Organism" << std::endl;
     throw "Organism method called!";}
+  virtual size_t GetPhyloID() {
+    std::cout << "GetPhyloID called from an Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void SetPhyloID(size_t _in) {
+    std::cout << "SetPhyloID called from an Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void AddToDigest(StateHasher & hasher) {
+    std::cout << "AddToDigest called from an Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void AddToGenotype(Genotype & genotype) {
+    std::cout << "AddToGenotype called from an Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual bool IsInGenotypes() {
+    std::cout << "IsInGenotypes called from an Organism" << std::endl;
+    throw "Organism method called!";}
+  virtual void SetInGenotypes(bool _in) {
+    std::cout << "SetInGenotypes called from an Organism" << std::endl;
+    throw "Organism method called!";}
 
   //EfficientSymbiont functions
   virtual double GetEfficiency() {
@@ -134,10 +161,10 @@ class Organism {
 
   //Host functions
 
-  virtual emp::vector<emp::Ptr<Organism>>& GetSymbionts() {
+  virtual SymList& GetSymbionts() {
     std::cout << "GetSymbionts called from Organism" << std::endl;
     throw "Organism method called!";}
-  virtual emp::vector<emp::Ptr<Organism>>& GetReproSymbionts() {
+  virtual SymList& GetReproSymbionts() {
     std::cout << "GetReproSymbionts called from Organism" << std::endl;
     throw "Organism method called!";}
   virtual void SetResInProcess(double _in){
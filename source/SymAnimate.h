@@ -71,6 +71,16 @@ public:
     config_panel.ExcludeSetting("START_MOI");
     config_panel.ExcludeSetting("PHYLOGENY");
     config_panel.ExcludeSetting("NUM_PHYLO_BINS");
+    config_panel.ExcludeSetting("PHYLOGENY_TRACKER");
+    config_panel.ExcludeSetting("PHYLOGENY_PRUNE_INT");
+    config_panel.ExcludeSetting("GENOTYPE_TABLE");
+    config_panel.ExcludeSetting("GRID_TOPOLOGY");
+    config_panel.ExcludeSetting("GRID_RADIUS");
+    config_panel.ExcludeSetting("GRID_WRAP");
+    config_panel.ExcludeSetting("DISPERSAL_KERNEL");
+    config_panel.ExcludeSetting("DISPERSAL_SCALE");
+    config_panel.ExcludeSetting("DISPERSAL_EXPONENT");
+    config_panel.ExcludeSetting("DISPERSAL_MAX_DIST");
 
     config_panel.ExcludeGroup("LYSIS");
     config_panel.ExcludeGroup("DTH");
@@ -225,7 +235,7 @@ public:
         //bool temp_passed = true;
         for (int x = 0; x < config.GRID_X(); x++){
             for (int y = 0; y < config.GRID_Y(); y++){
-                emp::vector<emp::Ptr<Organism>>& syms = p[i]->GetSymbionts(); // retrieve all syms for this host (assume only 1 sym for each host)
+                SymList& syms = p[i]->GetSymbionts(); // retrieve all syms for this host (assume only 1 sym for each host)
                 // color setting for host and symbiont
 
                 std::string color_host = matchColor(p[i]->GetIntVal());
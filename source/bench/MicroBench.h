@@ -0,0 +1,161 @@
+#ifndef MICRO_BENCH_H
+#define MICRO_BENCH_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+
+/**
+ * Times small kernels, such as one call of Host::Process on every host of a
+ * synthetic population, to evaluate kernel level optimizations without full
+ * runs.
+ *
+ * Each benchmark builds its population and then calls Measure with a reset
+ * function, which is not timed, and a kernel, which returns how many
+ * operations it performed. Every sample resets and then times one call of the
+ * kernel; the first few samples warm up caches and are discarded. Results are
+ * printed as csv rows in nanoseconds per operation.
+ */
+class MicroBench {
+public:
+  /**
+   * The settings shared by every benchmark, set from the command line.
+   */
+  struct Options {
+    size_t pop_size = 10000;
+    double moi = 1;
+    size_t samples = 20;
+    size_t warmup = 3;
+    std::string filter = "";
+  };
+
+  using bench_fun_t = std::function<void(MicroBench &)>;
+
+protected:
+  /**
+    *
+    * Purpose: Represents the options, the registered benchmarks and the name
+    * of the one being run.
+    *
+  */
+  Options options;
+  emp::vector<std::pair<std::string, bench_fun_t>> benchmarks;
+  std::string current;
+
+  /**
+    *
+    * Purpose: Represents a value kernels can add their results to, so the
+    * compiler cannot skip computing them.
+    *
+  */
+  volatile double sink = 0;
+
+public:
+  /**
+   * Input: The options.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a MicroBench.
+   */
+  MicroBench(const Options & _options) : options(_options) {}
+
+
+  /**
+   * Input: None
+   *
+   * Output: The options.
+   *
+   * Purpose: To let benchmarks size their populations.
+   */
+  const Options & GetOptions() const { return options; }
+
+
+  /**
+   * Input: The name of the benchmark; the function that builds its population
+   * and calls Measure.
+   *
+   * Output: None
+   *
+   * Purpose: To register a benchmark.
+   */
+  void Add(const std::string & name, bench_fun_t fun) {
+    benchmarks.emplace_back(name, fun);
+  }
+
+
+  /**
+   * Input: A value computed by a kernel.
+   *
+   * Output: None
+   *
+   * Purpose: To keep the compiler from optimizing the computation away.
+   */
+  void Use(double val) { sink = sink + val; }
+
+
+  /**
+   * Input: The function that restores the population before each sample; the
+   * kernel, which returns the number of operations it performed.
+   *
+   * Output: None
+   *
+   * Purpose: To time a kernel and print its nanoseconds per operation: the
+   * mean, standard deviation, minimum and median over the samples.
+   */
+  void Measure(std::function<void()> reset, std::function<size_t()> kernel) {
+    emp::vector<double> ns_per_op;
+    size_t ops = 0;
+    for (size_t sample = 0; sample < options.warmup + options.samples; sample++) {
+      reset();
+      auto begin = std::chrono::steady_clock::now();
+      ops = kernel();
+      auto end = std::chrono::steady_clock::now();
+      if (sample < options.warmup || ops == 0) continue;
+      ns_per_op.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / ops);
+    }
+    if (ns_per_op.empty()) {
+      std::cout << current << "," << options.pop_size << ",0,0,,,," << std::endl;
+      return;
+    }
+
+    double mean = 0;
+    for (double ns : ns_per_op) mean += ns;
+    mean /= ns_per_op.size();
+    double variance = 0;
+    for (double ns : ns_per_op) variance += (ns - mean) * (ns - mean);
+    if (ns_per_op.size() > 1) variance /= ns_per_op.size() - 1;
+    std::sort(ns_per_op.begin(), ns_per_op.end());
+    size_t mid = ns_per_op.size() / 2;
+    double median = ns_per_op.size() % 2 ? ns_per_op[mid] : (ns_per_op[mid - 1] + ns_per_op[mid]) / 2;
+
+    std::cout << current << "," << options.pop_size << "," << ops << "," << ns_per_op.size() << ","
+              << mean << "," << std::sqrt(variance) << "," << ns_per_op[0] << "," << median << std::endl;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of benchmarks run.
+   *
+   * Purpose: To run every benchmark whose name contains the filter.
+   */
+  size_t Run() {
+    std::cout << "kernel,pop_size,ops_per_sample,samples,mean_ns,sd_ns,min_ns,median_ns" << std::endl;
+    size_t num_run = 0;
+    for (auto & [name, fun] : benchmarks) {
+      if (name.find(options.filter) == std::string::npos) continue;
+      current = name;
+      fun(*this);
+      num_run++;
+    }
+    return num_run;
+  }
+};
+
+#endif
@@ -0,0 +1,275 @@
+#include "MicroBench.h"
+#include "../default_mode/SymWorld.h"
+#include "../default_mode/Host.h"
+#include "../default_mode/Symbiont.h"
+#include "../default_mode/ResourceKernel.h"
+#include "../default_mode/WorldSetup.cc"
+#include <cmath>
+
+/**
+ * A SymWorld whose data node lambdas can be run without the rest of an update.
+ */
+class BenchWorld : public SymWorld {
+public:
+  using SymWorld::SymWorld;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To run every lambda registered by the data node getters.
+   */
+  void TriggerDataNodes() { on_update_sig.Trigger(GetUpdate()); }
+};
+
+
+/**
+ * Input: The number of host-symbiont pairs; for each pair, the interaction
+ * values of the host and symbiont and the resources given to the pair; the
+ * SYNERGY multiplier; arrays to put the points each host and symbiont gain.
+ *
+ * Output: None
+ *
+ * Purpose: To time ResourceKernel::DistribPair over contiguous arrays, in a
+ * loop the compiler can vectorize. The update does not distribute resources
+ * this way.
+ */
+void DistribBatch(size_t num_pairs, const double * host_int_vals, const double * sym_int_vals,
+                  const double * sym_pieces, double synergy, double * host_gains, double * sym_gains) {
+  for (size_t i = 0; i < num_pairs; i++) {
+    ResourceKernel::DistribPair(host_int_vals[i], sym_int_vals[i], sym_pieces[i], synergy, host_gains[i], sym_gains[i]);
+  }
+}
+
+
+/**
+ * Input: The config to set; the benchmark options; whether to place hosts on a
+ * grid.
+ *
+ * Output: None
+ *
+ * Purpose: To configure a synthetic population of the requested size and
+ * multiplicity of infection, with random interaction values, in which no
+ * host or symbiont reproduces, so every sample does the same work.
+ */
+void SetupBenchConfig(SymConfigBase & config, const MicroBench::Options & options, bool grid = false) {
+  size_t side = (size_t) std::ceil(std::sqrt((double) options.pop_size));
+  config.GRID(grid);
+  config.GRID_X(side);
+  config.GRID_Y((options.pop_size + side - 1) / side);
+  config.POP_SIZE(options.pop_size);
+  config.START_MOI(options.moi);
+  config.SYM_LIMIT(std::max(1, (int) std::ceil(options.moi)));
+  config.HOST_INT(-2);
+  config.SYM_INT(-2);
+  config.HOST_REPRO_RES(1e12);
+  config.SYM_HORIZ_TRANS_RES(1e12);
+  config.PHYLOGENY(0);
+}
+
+
+/**
+ * Input: The world.
+ *
+ * Output: The cells of the world that hold a host.
+ *
+ * Purpose: To list the hosts a kernel should visit.
+ */
+emp::vector<size_t> GetHostCells(SymWorld & world) {
+  emp::vector<size_t> cells;
+  for (size_t i = 0; i < world.GetSize(); i++) {
+    if (world.IsOccupied(i)) cells.push_back(i);
+  }
+  return cells;
+}
+
+
+/**
+ * Input: The world.
+ *
+ * Output: Every symbiont living in a host.
+ *
+ * Purpose: To list the hosted symbionts a kernel should visit.
+ */
+emp::vector<emp::Ptr<Organism>> GetHostedSyms(SymWorld & world) {
+  emp::vector<emp::Ptr<Organism>> syms;
+  for (size_t cell : GetHostCells(world)) {
+    for (emp::Ptr<Organism> sym : world.GetOrg(cell).GetSymbionts()) syms.push_back(sym);
+  }
+  return syms;
+}
+
+
+/**
+ * Input: The world.
+ *
+ * Output: None
+ *
+ * Purpose: To set the points of every host and hosted symbiont to 0, so that
+ * repeated samples start from the same state.
+ */
+void ResetPoints(SymWorld & world) {
+  for (size_t cell : GetHostCells(world)) {
+    world.GetOrg(cell).SetPoints(0);
+    for (emp::Ptr<Organism> sym : world.GetOrg(cell).GetSymbionts()) sym->SetPoints(0);
+  }
+}
+
+
+/**
+ * Input: The MicroBench to add to.
+ *
+ * Output: None
+ *
+ * Purpose: To register the default mode kernels: host and symbiont
+ * processing, resource distribution, mutation, neighbor lookup, and every
+ * data node lambda of SymWorld.
+ */
+void AddDefaultBenchmarks(MicroBench & bench) {
+  bench.Add("Host::Process", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    emp::vector<size_t> cells = GetHostCells(world);
+    bench.Measure([&]() { ResetPoints(world); }, [&]() {
+      for (size_t cell : cells) world.GetOrg(cell).Process(emp::WorldPosition(cell));
+      return cells.size();
+    });
+  });
+
+  bench.Add("Host::DistribResources", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    emp::vector<size_t> cells = GetHostCells(world);
+    bench.Measure([&]() { ResetPoints(world); }, [&]() {
+      for (size_t cell : cells) world.GetOrg(cell).DistribResources(config.RES_DISTRIBUTE());
+      return cells.size();
+    });
+  });
+
+  bench.Add("Host::DistribResToSym", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    emp::vector<emp::Ptr<Host>> hosts;
+    for (size_t cell : GetHostCells(world)) {
+      if (world.GetOrg(cell).HasSym()) hosts.push_back(dynamic_cast<Host *>(&world.GetOrg(cell)));
+    }
+    bench.Measure([&]() { ResetPoints(world); }, [&]() {
+      size_t ops = 0;
+      for (emp::Ptr<Host> host : hosts) {
+        double sym_piece = config.RES_DISTRIBUTE() / host->GetSymbionts().size();
+        for (emp::Ptr<Organism> sym : host->GetSymbionts()) {
+          host->DistribResToSym(sym, sym_piece);
+          ops++;
+        }
+      }
+      return ops;
+    });
+  });
+
+  bench.Add("DistribBatch", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    emp::vector<double> host_int_vals, sym_int_vals, sym_pieces;
+    for (size_t cell : GetHostCells(world)) {
+      SymList & syms = world.GetOrg(cell).GetSymbionts();
+      for (emp::Ptr<Organism> sym : syms) {
+        host_int_vals.push_back(world.GetOrg(cell).GetIntVal());
+        sym_int_vals.push_back(sym->GetIntVal());
+        sym_pieces.push_back(config.RES_DISTRIBUTE() / syms.size());
+      }
+    }
+    emp::vector<double> host_gains(sym_pieces.size()), sym_gains(sym_pieces.size());
+    bench.Measure([]() {}, [&]() {
+      DistribBatch(sym_pieces.size(), host_int_vals.data(), sym_int_vals.data(),
+                   sym_pieces.data(), config.SYNERGY(), host_gains.data(), sym_gains.data());
+      bench.Use(host_gains.size() ? host_gains[0] + sym_gains[0] : 0);
+      return sym_pieces.size();
+    });
+  });
+
+  bench.Add("Symbiont::ProcessResources", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    emp::vector<emp::Ptr<Organism>> syms = GetHostedSyms(world);
+    bench.Measure([&]() { ResetPoints(world); }, [&]() {
+      double returned = 0;
+      for (emp::Ptr<Organism> sym : syms) returned += sym->ProcessResources(50, sym->GetHost());
+      bench.Use(returned);
+      return syms.size();
+    });
+  });
+
+  bench.Add("Symbiont::Mutate", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    emp::vector<emp::Ptr<Organism>> syms = GetHostedSyms(world);
+    bench.Measure([]() {}, [&]() {
+      for (emp::Ptr<Organism> sym : syms) sym->Mutate();
+      return syms.size();
+    });
+  });
+
+  bench.Add("SymWorld::GetNeighborHost", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions(), true);
+    SymWorld world(random, &config);
+    worldSetup(&world, &config);
+    bench.Measure([]() {}, [&]() {
+      size_t found = 0;
+      for (size_t cell = 0; cell < world.GetSize(); cell++) found += world.GetNeighborHost(cell).GetIndex();
+      bench.Use(found);
+      return world.GetSize();
+    });
+  });
+
+  //each data node is timed in its own world, so only its lambda runs
+  emp::vector<std::pair<std::string, std::function<void(SymWorld &)>>> data_nodes = {
+    {"HostCount", [](SymWorld & world) { world.GetHostCountDataNode(); }},
+    {"SymCount", [](SymWorld & world) { world.GetSymCountDataNode(); }},
+    {"CountHostedSyms", [](SymWorld & world) { world.GetCountHostedSymsDataNode(); }},
+    {"CountFreeSyms", [](SymWorld & world) { world.GetCountFreeSymsDataNode(); }},
+    {"UninfectedHosts", [](SymWorld & world) { world.GetUninfectedHostsDataNode(); }},
+    {"HostIntVal", [](SymWorld & world) { world.GetHostIntValDataNode(); }},
+    {"SymIntVal", [](SymWorld & world) { world.GetSymIntValDataNode(); }},
+    {"FreeSymIntVal", [](SymWorld & world) { world.GetFreeSymIntValDataNode(); }},
+    {"HostedSymIntVal", [](SymWorld & world) { world.GetHostedSymIntValDataNode(); }},
+    {"SymInfectChance", [](SymWorld & world) { world.GetSymInfectChanceDataNode(); }},
+    {"FreeSymInfectChance", [](SymWorld & world) { world.GetFreeSymInfectChanceDataNode(); }},
+    {"HostedSymInfectChance", [](SymWorld & world) { world.GetHostedSymInfectChanceDataNode(); }},
+  };
+  for (auto & [name, get_node] : data_nodes) {
+    bench.Add("DataNodes::Get" + name + "DataNode", [get_node = get_node](MicroBench & bench) {
+      emp::Random random(1);
+      SymConfigBase config;
+      SetupBenchConfig(config, bench.GetOptions());
+      config.FREE_LIVING_SYMS(1);
+      BenchWorld world(random, &config);
+      worldSetup(&world, &config);
+      get_node(world);
+      bench.Measure([]() {}, [&]() {
+        world.TriggerDataNodes();
+        return world.GetSize();
+      });
+    });
+  }
+}
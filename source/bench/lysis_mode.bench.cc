@@ -0,0 +1,38 @@
+#include "MicroBench.h"
+#include "../lysis_mode/LysisWorld.h"
+#include "../lysis_mode/Bacterium.h"
+#include "../lysis_mode/Phage.h"
+#include "../lysis_mode/LysisWorldSetup.cc"
+
+/**
+ * Input: The MicroBench to add to.
+ *
+ * Output: None
+ *
+ * Purpose: To register the lysis mode kernels.
+ */
+void AddLysisBenchmarks(MicroBench & bench) {
+  //every phage is lytic and has the resources for one offspring per step
+  bench.Add("Phage::LysisStep", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    config.LYSIS(1);
+    config.LYSIS_CHANCE(1);
+    config.SYM_LYSIS_RES(1);
+    LysisWorld world(random, &config);
+    worldSetup(emp::Ptr<LysisWorld>(&world), &config);
+    emp::vector<size_t> cells = GetHostCells(world);
+    emp::vector<emp::Ptr<Organism>> phages = GetHostedSyms(world);
+    bench.Measure([&]() {
+      for (size_t cell : cells) {
+        for (emp::Ptr<Organism> baby : world.GetOrg(cell).GetReproSymbionts()) baby.Delete();
+        world.GetOrg(cell).ClearReproSyms();
+      }
+      for (emp::Ptr<Organism> phage : phages) phage->SetPoints(config.SYM_LYSIS_RES());
+    }, [&]() {
+      for (emp::Ptr<Organism> phage : phages) phage->LysisStep();
+      return phages.size();
+    });
+  });
+}
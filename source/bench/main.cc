@@ -0,0 +1,38 @@
+// The microbenchmark driver: times single kernels on synthetic populations.
+// Usage: ./symbulation.microbench [-pop N] [-moi X] [-samples N] [-warmup N] [-filter NAME]
+
+#include "MicroBench.h"
+#include "default_mode.bench.cc"
+#include "lysis_mode.bench.cc"
+#include "pgg_mode.bench.cc"
+#include <cstdlib>
+
+int main(int argc, char * argv[]) {
+  MicroBench::Options options;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string arg = argv[i];
+    if (arg == "-pop") options.pop_size = std::atol(argv[i + 1]);
+    else if (arg == "-moi") options.moi = std::atof(argv[i + 1]);
+    else if (arg == "-samples") options.samples = std::atol(argv[i + 1]);
+    else if (arg == "-warmup") options.warmup = std::atol(argv[i + 1]);
+    else if (arg == "-filter") options.filter = argv[i + 1];
+    else {
+      std::cerr << "Unknown option " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (argc % 2 == 0 || options.pop_size == 0) {
+    std::cerr << "Usage: " << argv[0] << " [-pop N] [-moi X] [-samples N] [-warmup N] [-filter NAME]" << std::endl;
+    return 1;
+  }
+
+  MicroBench bench(options);
+  AddDefaultBenchmarks(bench);
+  AddLysisBenchmarks(bench);
+  AddPGGBenchmarks(bench);
+  if (bench.Run() == 0) {
+    std::cerr << "No benchmark matches " << options.filter << std::endl;
+    return 1;
+  }
+  return 0;
+}
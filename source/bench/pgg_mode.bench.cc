@@ -0,0 +1,33 @@
+#include "MicroBench.h"
+#include "../pgg_mode/PGGWorld.h"
+#include "../pgg_mode/PGGHost.h"
+#include "../pgg_mode/PGGSymbiont.h"
+#include "../pgg_mode/PGGWorldSetup.cc"
+
+/**
+ * Input: The MicroBench to add to.
+ *
+ * Output: None
+ *
+ * Purpose: To register the PGG mode kernels.
+ */
+void AddPGGBenchmarks(MicroBench & bench) {
+  bench.Add("PGGHost::DistribPool", [](MicroBench & bench) {
+    emp::Random random(1);
+    SymConfigBase config;
+    SetupBenchConfig(config, bench.GetOptions());
+    PGGWorld world(random, &config);
+    worldSetup(emp::Ptr<PGGWorld>(&world), &config);
+    emp::vector<emp::Ptr<Organism>> hosts;
+    for (size_t cell : GetHostCells(world)) {
+      if (world.GetOrg(cell).HasSym()) hosts.push_back(&world.GetOrg(cell));
+    }
+    bench.Measure([&]() {
+      ResetPoints(world);
+      for (emp::Ptr<Organism> host : hosts) host->SetPool(config.RES_DISTRIBUTE());
+    }, [&]() {
+      for (emp::Ptr<Organism> host : hosts) host->DistribPool();
+      return hosts.size();
+    });
+  });
+}
@@ -2,11 +2,27 @@
 #define CATCH_CONFIG_MAIN
 
 #include "catch.hpp"
+#include "trait_approx.h"
 
 #include "sanity_check.test.cc"
 
 #include "../test/default_mode_test/SymWorld.test.cc"
 #include "../test/default_mode_test/DataNodes.test.cc"
+#include "../test/default_mode_test/SymDataFile.test.cc"
+#include "../test/default_mode_test/RecordStream.test.cc"
+#include "../test/default_mode_test/AdaptiveTiming.test.cc"
+#include "../test/default_mode_test/BinnedPhylogeny.test.cc"
+#include "../test/default_mode_test/LineagePhylogeny.test.cc"
+#include "../test/default_mode_test/AbundanceIndex.test.cc"
+#include "../test/default_mode_test/PhaseProfiler.test.cc"
+#include "../test/default_mode_test/ObjectCensus.test.cc"
+#include "../test/default_mode_test/SymList.test.cc"
+#include "../test/default_mode_test/ResourceKernel.test.cc"
+#include "../test/default_mode_test/SymContext.test.cc"
+#include "../test/default_mode_test/TraitValue.test.cc"
+#include "../test/default_mode_test/GenotypeTable.test.cc"
+#include "../test/default_mode_test/NeighborTable.test.cc"
+#include "../test/default_mode_test/DispersalKernel.test.cc"
 
 #include "../test/default_mode_test/Host.test.cc"
 #include "../test/default_mode_test/Symbiont.test.cc"
@@ -0,0 +1,22 @@
+#ifndef TRAIT_APPROX_H
+#define TRAIT_APPROX_H
+
+#include "catch.hpp"
+#include "../default_mode/TraitValue.h"
+
+/**
+ * Input: The value expected if traits were stored exactly; the most the
+ * value can change per unit of rounding in the traits it is computed from
+ * (for points, about the resources involved times the number of traits).
+ *
+ * Output: A Catch Approx that is exact when traits are doubles and allows
+ * for the rounding of the stored traits when they are not.
+ *
+ * Purpose: To check values computed from traits, such as points, in every
+ * TRAIT_BITS build without loosening the checks of the double build.
+ */
+inline Approx TraitApprox(double expected, double sensitivity = 1) {
+  return Approx(expected).epsilon(0).margin(sensitivity * TRAIT_ROUNDING);
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef ABUNDANCE_INDEX_H
+#define ABUNDANCE_INDEX_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * Hashes a pair of hashable values, so pairs can be used as index keys.
+ */
+struct PairHash {
+  template <typename T1, typename T2>
+  size_t operator()(const std::pair<T1, T2> & p) const {
+    size_t h = std::hash<T1>()(p.first);
+    return h ^ (std::hash<T2>()(p.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+  }
+};
+
+
+/**
+ * Keeps the count of each key in buckets of keys with equal counts, so that
+ * the most abundant key can be found without a scan.
+ *
+ * Adding or removing one from a key's count moves the key between adjacent
+ * buckets, and the highest non-empty bucket is tracked, so updates are
+ * constant time amortized and GetDominant is constant time.
+ */
+template <typename KEY, typename HASH = std::hash<KEY>>
+class AbundanceIndex {
+protected:
+  /**
+   * The count of a key and its slot in the bucket for that count.
+   */
+  struct Entry {
+    size_t count = 0;
+    size_t slot = 0;
+  };
+
+  /**
+    *
+    * Purpose: Represents the count and bucket slot of every key with a
+    * nonzero count.
+    *
+  */
+  std::unordered_map<KEY, Entry, HASH> entries;
+
+  /**
+    *
+    * Purpose: Represents the keys with each count, indexed by count.
+    *
+  */
+  emp::vector<emp::vector<KEY>> buckets;
+
+  /**
+    *
+    * Purpose: Represents the highest count of any key.
+    *
+  */
+  size_t max_count = 0;
+
+  /**
+   * Input: A key; its entry.
+   *
+   * Output: None
+   *
+   * Purpose: To take a key out of the bucket for its count, filling its slot
+   * with the last key of the bucket.
+   */
+  void Unslot(const KEY & key, Entry & entry) {
+    emp::vector<KEY> & bucket = buckets[entry.count];
+    KEY moved = bucket.back();
+    bucket[entry.slot] = moved;
+    entries[moved].slot = entry.slot;
+    bucket.pop_back();
+  }
+
+  /**
+   * Input: A key; its entry.
+   *
+   * Output: None
+   *
+   * Purpose: To put a key into the bucket for its count.
+   */
+  void Slot(const KEY & key, Entry & entry) {
+    if (buckets.size() <= entry.count) buckets.resize(entry.count + 1);
+    entry.slot = buckets[entry.count].size();
+    buckets[entry.count].push_back(key);
+  }
+
+public:
+  /**
+   * Input: A key; optionally the amount to add to its count.
+   *
+   * Output: None
+   *
+   * Purpose: To increase the count of a key.
+   */
+  void Add(const KEY & key, size_t amount=1) {
+    if (amount == 0) return;
+    Entry & entry = entries[key];
+    if (entry.count) Unslot(key, entry);
+    entry.count += amount;
+    Slot(key, entry);
+    if (entry.count > max_count) max_count = entry.count;
+  }
+
+
+  /**
+   * Input: A key; optionally the amount to remove from its count.
+   *
+   * Output: None
+   *
+   * Purpose: To decrease the count of a key, forgetting it once its count
+   * reaches zero. Removing a key that is not in the index does nothing.
+   */
+  void Remove(const KEY & key, size_t amount=1) {
+    auto found = entries.find(key);
+    if (found == entries.end() || amount == 0) return;
+    Entry & entry = found->second;
+    Unslot(key, entry);
+    entry.count -= std::min(amount, entry.count);
+    if (entry.count) Slot(key, entry);
+    else entries.erase(found);
+    while (max_count && buckets[max_count].empty()) max_count--;
+  }
+
+
+  /**
+   * Input: A key.
+   *
+   * Output: The count of the key.
+   *
+   * Purpose: To look up how abundant a key is.
+   */
+  size_t GetCount(const KEY & key) const {
+    auto found = entries.find(key);
+    return found == entries.end() ? 0 : found->second.count;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The highest count of any key.
+   *
+   * Purpose: To look up the abundance of the dominant key.
+   */
+  size_t GetMaxCount() const { return max_count; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: A key with the highest count, or a default constructed key if
+   * the index is empty.
+   *
+   * Purpose: To find the dominant key.
+   */
+  KEY GetDominant() const {
+    if (max_count == 0) return KEY();
+    return buckets[max_count].front();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of keys with a nonzero count.
+   *
+   * Purpose: To determine how many distinct keys are present.
+   */
+  size_t GetNumKeys() const { return entries.size(); }
+};
+
+#endif
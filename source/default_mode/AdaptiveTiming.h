@@ -0,0 +1,216 @@
+#ifndef ADAPTIVE_TIMING_H
+#define ADAPTIVE_TIMING_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <cmath>
+#include <algorithm>
+
+/**
+ * Decides, once per update, whether data files should print a row, based on
+ * how much the tracked statistics have changed since the last row printed.
+ */
+class AdaptiveTiming {
+public:
+  /**
+   * The statistics the decision is based on, taken each update.
+   */
+  struct Stats {
+    double host_count = 0;
+    double sym_count = 0;
+    double host_mean = 0;
+    double sym_mean = 0;
+    emp::vector<size_t> host_hist;
+    emp::vector<size_t> sym_hist;
+  };
+
+protected:
+  /**
+    *
+    * Purpose: Represents the fewest and most updates allowed between rows.
+    *
+  */
+  size_t min_interval;
+  size_t max_interval;
+
+  /**
+    *
+    * Purpose: Represents how many updates rows are printed at min_interval
+    * after an extinction event.
+    *
+  */
+  size_t event_window;
+
+  /**
+    *
+    * Purpose: Represents the relative change in host or symbiont count, the
+    * absolute change in mean interaction value, and the total variation
+    * distance between histograms that each trigger a row.
+    *
+  */
+  double count_threshold;
+  double mean_threshold;
+  double hist_threshold;
+
+  /**
+    *
+    * Purpose: Represents the statistics at the last row printed, and the
+    * update it was printed at.
+    *
+  */
+  bool has_printed = false;
+  size_t last_print = 0;
+  Stats last_stats;
+
+  /**
+    *
+    * Purpose: Represents the host and symbiont counts at the previous update,
+    * used to detect extinctions as soon as they happen.
+    *
+  */
+  double prev_host_count = 0;
+  double prev_sym_count = 0;
+
+  /**
+    *
+    * Purpose: Represents the last update of the current high resolution window.
+    *
+  */
+  size_t high_res_until = 0;
+  bool in_high_res = false;
+
+  /**
+    *
+    * Purpose: Represents the update the current decision was made for, so
+    * that every data file gets the same answer.
+    *
+  */
+  bool has_decided = false;
+  size_t decided_update = 0;
+  bool decision = false;
+
+  /**
+   * Input: Two histograms.
+   *
+   * Output: The total variation distance between the two normalized
+   * histograms, between 0 and 1.
+   *
+   * Purpose: To measure how much the shape of a distribution has changed.
+   */
+  static double HistDistance(const emp::vector<size_t> & a, const emp::vector<size_t> & b) {
+    if (a.size() != b.size()) return 1.0;
+    double total_a = 0, total_b = 0;
+    for (size_t i = 0; i < a.size(); i++) { total_a += a[i]; total_b += b[i]; }
+    if (total_a == 0 || total_b == 0) return (total_a == total_b) ? 0.0 : 1.0;
+    double distance = 0;
+    for (size_t i = 0; i < a.size(); i++) distance += std::abs(a[i]/total_a - b[i]/total_b);
+    return distance / 2;
+  }
+
+  /**
+   * Input: A count now and the same count at the last row.
+   *
+   * Output: The relative change between them.
+   *
+   * Purpose: To compare counts of very different sizes on one scale.
+   */
+  static double RelativeChange(double now, double before) {
+    return std::abs(now - before) / std::max(before, 1.0);
+  }
+
+public:
+  /**
+   * Input: The fewest and most updates between rows; the number of updates to
+   * stay at high resolution after an extinction; the count, mean and
+   * histogram thresholds.
+   *
+   * Output: None
+   *
+   * Purpose: To construct an AdaptiveTiming.
+   */
+  AdaptiveTiming(size_t _min_interval, size_t _max_interval, size_t _event_window,
+                 double _count_threshold, double _mean_threshold, double _hist_threshold)
+    : min_interval(std::max<size_t>(_min_interval, 1)), max_interval(std::max<size_t>(_max_interval, 1)),
+      event_window(_event_window), count_threshold(_count_threshold),
+      mean_threshold(_mean_threshold), hist_threshold(_hist_threshold) {}
+
+
+  /**
+   * Input: The current update.
+   *
+   * Output: The bool representing if a decision has already been made for it.
+   *
+   * Purpose: To let callers skip gathering statistics when the answer is known.
+   */
+  bool HasDecided(size_t update) const { return has_decided && decided_update == update; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing the most recent decision.
+   *
+   * Purpose: To retrieve the decision made for the current update.
+   */
+  bool GetDecision() const { return decision; }
+
+
+  /**
+   * Input: The current update; the statistics at this update.
+   *
+   * Output: The bool representing if a row should be printed this update.
+   *
+   * Purpose: To decide whether to print. Rows are always printed for the first
+   * update, when max_interval updates have passed, and when hosts or symbionts
+   * go extinct. An extinction also starts a window of event_window updates
+   * printed every min_interval. Otherwise a row is printed once min_interval
+   * updates have passed and any statistic has moved past its threshold.
+   * The decision is remembered, so asking again for the same update gives the
+   * same answer without looking at the statistics.
+   */
+  bool ShouldPrint(size_t update, const Stats & stats) {
+    if (HasDecided(update)) return decision;
+
+    bool extinction = (prev_host_count > 0 && stats.host_count == 0) ||
+                      (prev_sym_count > 0 && stats.sym_count == 0);
+    prev_host_count = stats.host_count;
+    prev_sym_count = stats.sym_count;
+    if (extinction) {
+      high_res_until = update + event_window;
+      in_high_res = true;
+    }
+
+    bool print = false;
+    if (!has_printed || extinction) {
+      print = true;
+    } else {
+      size_t since = update - last_print;
+      if (since >= max_interval) {
+        print = true;
+      } else if (since >= min_interval) {
+        if (in_high_res && update <= high_res_until) {
+          print = true;
+        } else {
+          print = RelativeChange(stats.host_count, last_stats.host_count) > count_threshold ||
+                  RelativeChange(stats.sym_count, last_stats.sym_count) > count_threshold ||
+                  std::abs(stats.host_mean - last_stats.host_mean) > mean_threshold ||
+                  std::abs(stats.sym_mean - last_stats.sym_mean) > mean_threshold ||
+                  HistDistance(stats.host_hist, last_stats.host_hist) > hist_threshold ||
+                  HistDistance(stats.sym_hist, last_stats.sym_hist) > hist_threshold;
+        }
+      }
+    }
+    if (in_high_res && update > high_res_until) in_high_res = false;
+
+    if (print) {
+      has_printed = true;
+      last_print = update;
+      last_stats = stats;
+    }
+    has_decided = true;
+    decided_update = update;
+    decision = print;
+    return print;
+  }
+};
+
+#endif
@@ -0,0 +1,357 @@
+#ifndef BINNED_PHYLOGENY_H
+#define BINNED_PHYLOGENY_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string>
+
+/**
+ * A phylogeny tracker for organisms classified into a small number of integer
+ * bins, such as the NUM_PHYLO_BINS interaction value bins.
+ *
+ * Each bin is treated as a single taxon. Instead of allocating a taxon per
+ * lineage, the tracker keeps per-bin counts and a bin-to-bin matrix of births
+ * in flat arrays, so adding and removing an organism is a few array updates.
+ * A bin originates when its first organism is born, and its ancestor is the
+ * bin of that organism's parent. If a bin goes extinct and is later
+ * repopulated, it originates again.
+ */
+class BinnedPhylogeny {
+public:
+  /**
+   * Purpose: Represents a missing bin, for organisms without a parent and for
+   * empty positions.
+   */
+  static constexpr size_t NO_BIN = std::numeric_limits<size_t>::max();
+
+protected:
+  /**
+    *
+    * Purpose: Represents the number of bins currently tracked.
+    *
+  */
+  size_t num_bins = 0;
+
+  /**
+    *
+    * Purpose: Represents the number of living organisms in each bin, and the
+    * total number ever born into each bin.
+    *
+  */
+  emp::vector<size_t> num_orgs;
+  emp::vector<size_t> tot_orgs;
+
+  /**
+    *
+    * Purpose: Represents the bin each bin most recently originated from, and
+    * its depth in the tree of origins at that time.
+    *
+  */
+  emp::vector<size_t> origin;
+  emp::vector<size_t> depth;
+
+  /**
+    *
+    * Purpose: Represents the number of times each bin has been the origin of
+    * another bin.
+    *
+  */
+  emp::vector<size_t> total_offspring;
+
+  /**
+    *
+    * Purpose: Represents the update each bin most recently originated, and the
+    * update it most recently went extinct (infinity while it is alive).
+    *
+  */
+  emp::vector<double> origin_time;
+  emp::vector<double> destruction_time;
+
+  /**
+    *
+    * Purpose: Represents the number of births from each parent bin into each
+    * child bin, stored row-major as parent * num_bins + child.
+    *
+  */
+  emp::vector<size_t> transitions;
+
+  /**
+    *
+    * Purpose: Represents the bin of the organism at each world position, for
+    * organisms tracked by position.
+    *
+  */
+  emp::vector<size_t> position_bins;
+
+  /**
+    *
+    * Purpose: Represents the number of bins with living organisms.
+    *
+  */
+  size_t num_active = 0;
+
+  /**
+   * Input: The number of bins needed.
+   *
+   * Output: None
+   *
+   * Purpose: To grow the flat arrays when an organism is classified into a
+   * bin beyond the current number of bins.
+   */
+  void EnsureBins(size_t new_num_bins) {
+    if (new_num_bins <= num_bins) return;
+    emp::vector<size_t> new_transitions(new_num_bins * new_num_bins, 0);
+    for (size_t parent = 0; parent < num_bins; parent++) {
+      for (size_t child = 0; child < num_bins; child++) {
+        new_transitions[parent * new_num_bins + child] = transitions[parent * num_bins + child];
+      }
+    }
+    transitions = new_transitions;
+    num_orgs.resize(new_num_bins, 0);
+    tot_orgs.resize(new_num_bins, 0);
+    origin.resize(new_num_bins, NO_BIN);
+    depth.resize(new_num_bins, 0);
+    total_offspring.resize(new_num_bins, 0);
+    origin_time.resize(new_num_bins, 0);
+    destruction_time.resize(new_num_bins, std::numeric_limits<double>::infinity());
+    num_bins = new_num_bins;
+  }
+
+public:
+  /**
+   * Input: The number of bins organisms are classified into.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a BinnedPhylogeny.
+   */
+  BinnedPhylogeny(size_t _num_bins) { EnsureBins(_num_bins); }
+
+
+  /**
+   * Input: The bin of the new organism; the bin of its parent, or NO_BIN;
+   * the current update.
+   *
+   * Output: The bin the organism was added to.
+   *
+   * Purpose: To record the birth of an organism.
+   */
+  size_t AddOrg(size_t bin, size_t parent_bin, size_t update) {
+    EnsureBins(bin + 1);
+    if (parent_bin != NO_BIN) {
+      EnsureBins(parent_bin + 1);
+      transitions[parent_bin * num_bins + bin]++;
+    }
+    if (num_orgs[bin] == 0) {
+      //the bin (re)originates from the parent's bin
+      num_active++;
+      origin[bin] = (parent_bin == bin) ? NO_BIN : parent_bin;
+      depth[bin] = (origin[bin] == NO_BIN) ? 0 : depth[origin[bin]] + 1;
+      if (origin[bin] != NO_BIN) total_offspring[origin[bin]]++;
+      origin_time[bin] = update;
+      destruction_time[bin] = std::numeric_limits<double>::infinity();
+    }
+    num_orgs[bin]++;
+    tot_orgs[bin]++;
+    return bin;
+  }
+
+
+  /**
+   * Input: The bin of the organism; the current update; optionally the number
+   * of organisms of the bin that died.
+   *
+   * Output: None
+   *
+   * Purpose: To record the death of one or more organisms of a bin.
+   */
+  void RemoveOrg(size_t bin, size_t update, size_t count=1) {
+    if (bin >= num_bins || num_orgs[bin] == 0) return;
+    num_orgs[bin] -= std::min(count, num_orgs[bin]);
+    if (num_orgs[bin] == 0) {
+      num_active--;
+      destruction_time[bin] = update;
+    }
+  }
+
+
+  /**
+   * Input: The world position of the new organism; its bin; the bin of its
+   * parent, or NO_BIN; the current update.
+   *
+   * Output: None
+   *
+   * Purpose: To record the birth of an organism tracked by position. Any
+   * organism already recorded at the position is removed first.
+   */
+  void AddOrgAt(size_t pos, size_t bin, size_t parent_bin, size_t update) {
+    RemoveOrgAt(pos, update);
+    if (pos >= position_bins.size()) position_bins.resize(pos + 1, NO_BIN);
+    position_bins[pos] = AddOrg(bin, parent_bin, update);
+  }
+
+
+  /**
+   * Input: The world position of the organism; the current update.
+   *
+   * Output: None
+   *
+   * Purpose: To record the death of an organism tracked by position.
+   */
+  void RemoveOrgAt(size_t pos, size_t update) {
+    if (pos >= position_bins.size() || position_bins[pos] == NO_BIN) return;
+    RemoveOrg(position_bins[pos], update);
+    position_bins[pos] = NO_BIN;
+  }
+
+
+  /**
+   * Input: The world position.
+   *
+   * Output: The bin of the organism at the position, or NO_BIN.
+   *
+   * Purpose: To look up the bin of an organism tracked by position.
+   */
+  size_t GetBinAt(size_t pos) const {
+    if (pos >= position_bins.size()) return NO_BIN;
+    return position_bins[pos];
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of bins with living organisms.
+   *
+   * Purpose: To determine how many taxa are active.
+   */
+  size_t GetNumActive() const { return num_active; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of bins tracked.
+   *
+   * Purpose: To determine the size of the flat arrays.
+   */
+  size_t GetNumBins() const { return num_bins; }
+
+
+  /**
+   * Input: A bin.
+   *
+   * Output: The number of living organisms in the bin.
+   *
+   * Purpose: To retrieve the size of a taxon.
+   */
+  size_t GetNumOrgs(size_t bin) const { return bin < num_bins ? num_orgs[bin] : 0; }
+
+
+  /**
+   * Input: A bin.
+   *
+   * Output: The number of organisms ever born into the bin.
+   *
+   * Purpose: To retrieve the total size of a taxon.
+   */
+  size_t GetTotOrgs(size_t bin) const { return bin < num_bins ? tot_orgs[bin] : 0; }
+
+
+  /**
+   * Input: A bin.
+   *
+   * Output: The bin it most recently originated from, or NO_BIN.
+   *
+   * Purpose: To retrieve the ancestor of a taxon.
+   */
+  size_t GetOrigin(size_t bin) const { return bin < num_bins ? origin[bin] : NO_BIN; }
+
+
+  /**
+   * Input: A bin.
+   *
+   * Output: The update the bin most recently originated.
+   *
+   * Purpose: To retrieve the origination time of a taxon.
+   */
+  double GetOriginationTime(size_t bin) const { return origin_time[bin]; }
+
+
+  /**
+   * Input: A bin.
+   *
+   * Output: The update the bin most recently went extinct, or infinity.
+   *
+   * Purpose: To retrieve the destruction time of a taxon.
+   */
+  double GetDestructionTime(size_t bin) const { return destruction_time[bin]; }
+
+
+  /**
+   * Input: A parent bin; a child bin.
+   *
+   * Output: The number of births from the parent bin into the child bin.
+   *
+   * Purpose: To retrieve an entry of the transition matrix.
+   */
+  size_t GetTransitions(size_t parent_bin, size_t child_bin) const {
+    if (parent_bin >= num_bins || child_bin >= num_bins) return 0;
+    return transitions[parent_bin * num_bins + child_bin];
+  }
+
+
+  /**
+   * Input: The path of the file to write.
+   *
+   * Output: None
+   *
+   * Purpose: To write every bin that has ever had organisms, in the same
+   * layout as emp::Systematics::Snapshot with an "info" column, so existing
+   * analysis scripts can read it. The id and info of a taxon are its bin.
+   */
+  void Snapshot(const std::string & file_path) const {
+    std::ofstream out(file_path);
+    out << "id,ancestor_list,origin_time,destruction_time,num_orgs,tot_orgs,num_offspring,total_offspring,depth,info\n";
+    emp::vector<size_t> num_offspring(num_bins, 0);
+    for (size_t bin = 0; bin < num_bins; bin++) {
+      if (num_orgs[bin] > 0 && origin[bin] != NO_BIN) num_offspring[origin[bin]]++;
+    }
+    //active bins first, then extinct ones, as emp::Systematics does
+    for (bool active : {true, false}) {
+      for (size_t bin = 0; bin < num_bins; bin++) {
+        if (tot_orgs[bin] == 0 || (num_orgs[bin] > 0) != active) continue;
+        out << bin << ',';
+        if (origin[bin] == NO_BIN) out << "[NONE]";
+        else out << '[' << origin[bin] << ']';
+        out << ',' << origin_time[bin] << ',' << destruction_time[bin]
+            << ',' << num_orgs[bin] << ',' << tot_orgs[bin]
+            << ',' << num_offspring[bin] << ',' << total_offspring[bin]
+            << ',' << depth[bin] << ',' << bin << '\n';
+      }
+    }
+  }
+
+
+  /**
+   * Input: The path of the file to write.
+   *
+   * Output: None
+   *
+   * Purpose: To write the nonzero entries of the bin-to-bin birth matrix.
+   */
+  void WriteTransitions(const std::string & file_path) const {
+    std::ofstream out(file_path);
+    out << "parent_bin,child_bin,births\n";
+    for (size_t parent = 0; parent < num_bins; parent++) {
+      for (size_t child = 0; child < num_bins; child++) {
+        size_t births = transitions[parent * num_bins + child];
+        if (births) out << parent << ',' << child << ',' << births << '\n';
+      }
+    }
+  }
+};
+
+#endif
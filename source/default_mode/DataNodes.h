@@ -3,6 +3,9 @@
 
 #include "SymWorld.h"
 
+class Host;
+class Symbiont;
+
 /**
 * Input: None.
 *
@@ -11,15 +14,30 @@
 * Purpose: To create and set up the data files (excluding for phylogeny) that contain data for the experiment.
 */
 void SymWorld::CreateDateFiles(){
-  int TIMING_REPEAT = my_config->DATA_INT();
   std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
 
-  SetupHostIntValFile(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
-  SetupSymIntValFile(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
-  SetUpTransmissionFile(my_config->FILE_PATH()+"TransmissionRates"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+  if(IsDataEnabled("HostVals")){
+    SetupHostIntValFile(my_config->FILE_PATH()+"HostVals"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+  }
+  if(IsDataEnabled("SymVals")){
+    SetupSymIntValFile(my_config->FILE_PATH()+"SymVals"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+  }
+  if(IsDataEnabled("TransmissionRates")){
+    SetUpTransmissionFile(my_config->FILE_PATH()+"TransmissionRates"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+  }
 
-  if(my_config->FREE_LIVING_SYMS() == 1){
-    SetUpFreeLivingSymFile(my_config->FILE_PATH()+"FreeLivingSyms_"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(TIMING_REPEAT);
+  if(my_config->FREE_LIVING_SYMS() == 1 && IsDataEnabled("FreeLivingSyms")){
+    SetUpFreeLivingSymFile(my_config->FILE_PATH()+"FreeLivingSyms_"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+  }
+  if(my_config->CENSUS_DATA() && IsDataEnabled("Census")){
+    SetupCensusFile(my_config->FILE_PATH()+"Census"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+  }
+  if(my_config->GENOTYPE_TABLE() && IsDataEnabled("Genotypes")){
+    SetupGenotypeFile(my_config->FILE_PATH()+"Genotypes"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+  }
+  if(my_config->DIGEST_INT() > 0 && IsDataEnabled("StateDigest")){
+    int digest_int = my_config->DIGEST_INT();
+    SetupStateDigestFile(my_config->FILE_PATH()+"StateDigest"+my_config->FILE_NAME()+file_ending).SetTiming([digest_int](size_t ud){ return ud % digest_int == 0; });
   }
 }
 
@@ -36,34 +54,39 @@ void SymWorld::CreateDateFiles(){
  */
 emp::DataFile & SymWorld::SetupSymIntValFile(const std::string & filename) {
   auto & file = SetupFile(filename);
-  auto & node = GetSymIntValDataNode();
-  auto & node1 = GetSymCountDataNode();
 
   file.AddVar(update, "update", "Update");
-  file.AddMean(node, "mean_intval", "Average symbiont interaction value");
-  file.AddTotal(node1, "count", "Total number of symbionts");
+  if(IsDataEnabled("SymVals", "mean_intval")){
+    file.AddMean(GetSymIntValDataNode(), "mean_intval", "Average symbiont interaction value");
+  }
+  if(IsDataEnabled("SymVals", "count")){
+    file.AddTotal(GetSymCountDataNode(), "count", "Total number of symbionts");
+  }
 
   //interaction val histogram
-  file.AddHistBin(node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
-  file.AddHistBin(node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
-  file.AddHistBin(node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
-  file.AddHistBin(node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
-  file.AddHistBin(node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
-  file.AddHistBin(node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
-  file.AddHistBin(node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
-  file.AddHistBin(node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
-  file.AddHistBin(node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
-  file.AddHistBin(node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
-  file.AddHistBin(node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-  file.AddHistBin(node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-  file.AddHistBin(node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-  file.AddHistBin(node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-  file.AddHistBin(node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-  file.AddHistBin(node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-  file.AddHistBin(node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-  file.AddHistBin(node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-  file.AddHistBin(node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-  file.AddHistBin(node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+  if(IsDataEnabled("SymVals", "Hist")){
+    auto & node = GetSymIntValDataNode();
+    file.AddHistBin(node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
+    file.AddHistBin(node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
+    file.AddHistBin(node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
+    file.AddHistBin(node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
+    file.AddHistBin(node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
+    file.AddHistBin(node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
+    file.AddHistBin(node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
+    file.AddHistBin(node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
+    file.AddHistBin(node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
+    file.AddHistBin(node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
+    file.AddHistBin(node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+    file.AddHistBin(node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+    file.AddHistBin(node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+    file.AddHistBin(node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+    file.AddHistBin(node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+    file.AddHistBin(node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+    file.AddHistBin(node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+    file.AddHistBin(node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+    file.AddHistBin(node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+    file.AddHistBin(node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+  }
 
   file.PrintHeaderKeys();
 
@@ -91,42 +114,148 @@ emp::DataFile & SymWorld::SetupHostIntValFile(const std::string & filename) {
 
 
 /**
- * Input: The Empirical DataFile object tracking data nodes.
+ * Input: The SymDataFile object tracking data nodes.
  *
  * Output: None.
  *
  * Purpose: To define which data nodes should be tracked by this data file. Defines
  * what columns should be called.
  */
-void SymWorld::SetupHostFileColumns(emp::DataFile & file){
-  auto & node = GetHostIntValDataNode();
-  auto & node1 = GetHostCountDataNode();
-  auto & uninf_hosts_node = GetUninfectedHostsDataNode();
+void SymWorld::SetupHostFileColumns(SymDataFile & file){
+  file.AddVar(update, "update", "Update");
+  if(IsDataEnabled("HostVals", "mean_intval")){
+    file.AddMean(GetHostIntValDataNode(), "mean_intval", "Average host interaction value");
+  }
+  if(IsDataEnabled("HostVals", "count")){
+    file.AddTotal(GetHostCountDataNode(), "count", "Total number of hosts");
+  }
+  if(IsDataEnabled("HostVals", "uninfected_host_count")){
+    file.AddTotal(GetUninfectedHostsDataNode(), "uninfected_host_count", "Total number of hosts that are uninfected");
+  }
+  if(IsDataEnabled("HostVals", "Hist")){
+    auto & node = GetHostIntValDataNode();
+    file.AddHistBin(node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
+    file.AddHistBin(node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
+    file.AddHistBin(node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
+    file.AddHistBin(node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
+    file.AddHistBin(node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
+    file.AddHistBin(node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
+    file.AddHistBin(node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
+    file.AddHistBin(node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
+    file.AddHistBin(node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
+    file.AddHistBin(node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
+    file.AddHistBin(node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+    file.AddHistBin(node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+    file.AddHistBin(node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+    file.AddHistBin(node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+    file.AddHistBin(node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+    file.AddHistBin(node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+    file.AddHistBin(node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+    file.AddHistBin(node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+    file.AddHistBin(node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+    file.AddHistBin(node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+  }
+}
+
+
+/**
+ * Input: The address of the string representing the file to be
+ * created's name
+ *
+ * Output: The address of the DataFile that has been created.
+ *
+ * Purpose: To set up the file that counts the organism objects in memory,
+ * for sizing jobs and catching leaks without an EMP_TRACK_MEM build.
+ */
+emp::DataFile & SymWorld::SetupCensusFile(const std::string & filename) {
+  auto & file = SetupFile(filename);
+  SetupCensusColumns(file);
+  file.PrintHeaderKeys();
+  return file;
+}
 
+
+/**
+ * Input: The address of the string representing the file to be
+ * created's name
+ *
+ * Output: The address of the DataFile that has been created.
+ *
+ * Purpose: To set up the file that records the digest of the world's state
+ * at the start of every DIGEST_INT updates. Two runs that should be identical
+ * can be compared line by line; the first differing line is the first update
+ * where they diverged.
+ */
+emp::DataFile & SymWorld::SetupStateDigestFile(const std::string & filename) {
+  auto & file = SetupFile(filename);
   file.AddVar(update, "update", "Update");
-  file.AddMean(node, "mean_intval", "Average host interaction value");
-  file.AddTotal(node1, "count", "Total number of hosts");
-  file.AddTotal(uninf_hosts_node, "uninfected_host_count", "Total number of hosts that are uninfected");
-  file.AddHistBin(node, 0, "Hist_-1", "Count for histogram bin -1 to <-0.9");
-  file.AddHistBin(node, 1, "Hist_-0.9", "Count for histogram bin -0.9 to <-0.8");
-  file.AddHistBin(node, 2, "Hist_-0.8", "Count for histogram bin -0.8 to <-0.7");
-  file.AddHistBin(node, 3, "Hist_-0.7", "Count for histogram bin -0.7 to <-0.6");
-  file.AddHistBin(node, 4, "Hist_-0.6", "Count for histogram bin -0.6 to <-0.5");
-  file.AddHistBin(node, 5, "Hist_-0.5", "Count for histogram bin -0.5 to <-0.4");
-  file.AddHistBin(node, 6, "Hist_-0.4", "Count for histogram bin -0.4 to <-0.3");
-  file.AddHistBin(node, 7, "Hist_-0.3", "Count for histogram bin -0.3 to <-0.2");
-  file.AddHistBin(node, 8, "Hist_-0.2", "Count for histogram bin -0.2 to <-0.1");
-  file.AddHistBin(node, 9, "Hist_-0.1", "Count for histogram bin -0.1 to <0.0");
-  file.AddHistBin(node, 10, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-  file.AddHistBin(node, 11, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-  file.AddHistBin(node, 12, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-  file.AddHistBin(node, 13, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-  file.AddHistBin(node, 14, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-  file.AddHistBin(node, 15, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-  file.AddHistBin(node, 16, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-  file.AddHistBin(node, 17, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-  file.AddHistBin(node, 18, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-  file.AddHistBin(node, 19, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+  file.AddCell([this](std::string & out){ out += StateHasher::ToHex(StateDigest()); },
+               "digest", "Digest of the world's state at the start of the update");
+  file.PrintHeaderKeys();
+  return file;
+}
+
+
+/**
+ * Input: The address of the string representing the file to be
+ * created's name
+ *
+ * Output: The address of the DataFile that has been created.
+ *
+ * Purpose: To set up the file that tracks genotypic diversity from the
+ * genotype tables: the number of host and symbiont genotypes, and the
+ * abundance and interaction value of the dominant genotype of each.
+ */
+emp::DataFile & SymWorld::SetupGenotypeFile(const std::string & filename) {
+  auto & file = SetupFile(filename);
+  file.AddVar(update, "update", "Update");
+  for (emp::Ptr<GenotypeTable> table : {host_genotypes, sym_genotypes}) {
+    std::string prefix = table == host_genotypes ? "host" : "sym";
+    file.AddCell([table](std::string & out){ AppendNumber(out, table->GetNumGenotypes()); },
+                 prefix + "_genotypes", "Number of distinct " + prefix + " genotypes");
+    file.AddCell([table](std::string & out){ AppendNumber(out, table->GetDominantCount()); },
+                 prefix + "_dominant_count", "Number of " + prefix + "s with the most abundant genotype");
+    file.AddCell([table](std::string & out){
+                   emp::Ptr<const Genotype> dominant = table->GetDominant();
+                   AppendNumber(out, dominant ? dominant->int_val : 0.0);
+                 }, prefix + "_dominant_intval", "Interaction value of the most abundant " + prefix + " genotype");
+  }
+  file.PrintHeaderKeys();
+  return file;
+}
+
+
+/**
+ * Input: The SymDataFile object tracking the census.
+ *
+ * Output: None.
+ *
+ * Purpose: To define the census columns: live objects, births and deletions
+ * of hosts and symbionts (including every subclass), the heap bytes held by
+ * the symbiont and reproductive symbiont lists of living hosts, and the peak
+ * resident memory of the process. Worlds with their own organism classes add
+ * columns for them.
+ */
+void SymWorld::SetupCensusColumns(SymDataFile & file){
+  file.AddVar(update, "update", "Update");
+  AddCensusColumns<Host>(file, "host");
+  AddCensusColumns<Symbiont>(file, "sym");
+  file.AddCell([this](std::string & out){
+    size_t bytes = 0;
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (IsOccupied(i)) bytes += pop[i]->GetSymbionts().GetHeapBytes();
+    }
+    AppendNumber(out, bytes);
+  }, "syms_bytes", "Heap bytes held by the symbiont lists of living hosts");
+  file.AddCell([this](std::string & out){
+    size_t bytes = 0;
+    for (size_t i = 0; i < pop.size(); i++) {
+      if (IsOccupied(i)) bytes += pop[i]->GetReproSymbionts().GetHeapBytes();
+    }
+    AppendNumber(out, bytes);
+  }, "repro_syms_bytes", "Heap bytes held by the reproductive symbiont lists of living hosts");
+  file.AddCell([](std::string & out){ AppendNumber(out, GetPeakMemoryKB()); },
+               "peak_memory_kb", "Peak resident memory of the process in kilobytes");
 }
 
 
@@ -146,33 +275,41 @@ void SymWorld::SetupHostFileColumns(emp::DataFile & file){
  */
 emp::DataFile & SymWorld::SetUpFreeLivingSymFile(const std::string & filename){
   auto & file = SetupFile(filename);
-  auto & node1 = GetSymCountDataNode(); //count
-  auto & node2 = GetCountFreeSymsDataNode();
-  auto & node3 = GetCountHostedSymsDataNode();
-  auto & node4 = GetSymIntValDataNode(); //interaction_val
-  auto & node5 = GetFreeSymIntValDataNode();
-  auto & node6 = GetHostedSymIntValDataNode();
-  auto & node7 = GetSymInfectChanceDataNode(); //infect chance
-  auto & node8 = GetFreeSymInfectChanceDataNode();
-  auto & node9 = GetHostedSymInfectChanceDataNode();
 
   file.AddVar(update, "update", "Update");
 
   //count
-  file.AddTotal(node1, "count", "Total number of symbionts");
-  file.AddTotal(node2, "free_syms", "Total number of free syms");
-  file.AddTotal(node3, "hosted_syms", "Total number of syms in a host");
-
+  if(IsDataEnabled("FreeLivingSyms", "count")){
+    file.AddTotal(GetSymCountDataNode(), "count", "Total number of symbionts");
+  }
+  if(IsDataEnabled("FreeLivingSyms", "free_syms")){
+    file.AddTotal(GetCountFreeSymsDataNode(), "free_syms", "Total number of free syms");
+  }
+  if(IsDataEnabled("FreeLivingSyms", "hosted_syms")){
+    file.AddTotal(GetCountHostedSymsDataNode(), "hosted_syms", "Total number of syms in a host");
+  }
 
   //interaction val
-  file.AddMean(node4, "mean_intval", "Average symbiont interaction value");
-  file.AddMean(node5, "mean_freeintval", "Average free symbiont interaction value");
-  file.AddMean(node6, "mean_hostedintval", "Average hosted symbiont interaction value");
+  if(IsDataEnabled("FreeLivingSyms", "mean_intval")){
+    file.AddMean(GetSymIntValDataNode(), "mean_intval", "Average symbiont interaction value");
+  }
+  if(IsDataEnabled("FreeLivingSyms", "mean_freeintval")){
+    file.AddMean(GetFreeSymIntValDataNode(), "mean_freeintval", "Average free symbiont interaction value");
+  }
+  if(IsDataEnabled("FreeLivingSyms", "mean_hostedintval")){
+    file.AddMean(GetHostedSymIntValDataNode(), "mean_hostedintval", "Average hosted symbiont interaction value");
+  }
 
   //infection chance
-  file.AddMean(node7, "mean_infectchance", "Average symbiont infection chance");
-  file.AddMean(node8, "mean_freeinfectchance", "Average free symbiont infection chance");
-  file.AddMean(node9, "mean_hostedinfectchance", "Average hosted symbiont infection chance");
+  if(IsDataEnabled("FreeLivingSyms", "mean_infectchance")){
+    file.AddMean(GetSymInfectChanceDataNode(), "mean_infectchance", "Average symbiont infection chance");
+  }
+  if(IsDataEnabled("FreeLivingSyms", "mean_freeinfectchance")){
+    file.AddMean(GetFreeSymInfectChanceDataNode(), "mean_freeinfectchance", "Average free symbiont infection chance");
+  }
+  if(IsDataEnabled("FreeLivingSyms", "mean_hostedinfectchance")){
+    file.AddMean(GetHostedSymInfectChanceDataNode(), "mean_hostedinfectchance", "Average hosted symbiont infection chance");
+  }
 
   file.PrintHeaderKeys();
 
@@ -189,11 +326,79 @@ emp::DataFile & SymWorld::SetUpFreeLivingSymFile(const std::string & filename){
  * the host systematic information
  */
 void SymWorld::WritePhylogenyFile(const std::string & filename) {
+  if (sym_bin_sys) {
+    //the binned trackers also record how often births cross from one bin to another
+    sym_bin_sys->Snapshot("SymSnapshot_"+filename);
+    host_bin_sys->Snapshot("HostSnapshot_"+filename);
+    sym_bin_sys->WriteTransitions("SymTransitions_"+filename);
+    host_bin_sys->WriteTransitions("HostTransitions_"+filename);
+    return;
+  }
+  if (sym_lineage_sys) {
+    //only the surviving tree is written
+    sym_lineage_sys->Snapshot("SymSnapshot_"+filename);
+    host_lineage_sys->Snapshot("HostSnapshot_"+filename);
+    return;
+  }
   sym_sys->Snapshot("SymSnapshot_"+filename);
   host_sys->Snapshot("HostSnapshot_"+filename);
 }
 
 
+/**
+ * Input: None
+ *
+ * Output: The pointer to the symbiont taxon with the most living symbionts, or
+ * nullptr if there are none or the full phylogeny tracker is not used.
+ *
+ * Purpose: To find the dominant symbiont taxon without scanning the taxa.
+ */
+emp::Ptr<emp::Taxon<int>> SymWorld::GetDominantSymTaxon() {
+  return sym_taxon_index.GetDominant();
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: The pointer to the host taxon with the most living hosts, or
+ * nullptr if there are none or the full phylogeny tracker is not used.
+ *
+ * Purpose: To find the dominant host taxon without scanning the taxa.
+ */
+emp::Ptr<emp::Taxon<int>> SymWorld::GetDominantHostTaxon() {
+  return host_taxon_index.GetDominant();
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: The vector holding the pointers to the dominant free-living symbiont
+ * taxon and the dominant hosted symbiont taxon, either of which may be nullptr.
+ *
+ * Purpose: To find the dominant symbiont taxa in and out of hosts.
+ */
+emp::vector<emp::Ptr<emp::Taxon<int>>> SymWorld::GetDominantFreeHostedSymTaxon() {
+  return {free_sym_taxon_index.GetDominant(), hosted_sym_taxon_index.GetDominant()};
+}
+
+
+/**
+ * Input: None
+ *
+ * Output: The pair of the host taxon and symbiont taxon with the most hosted
+ * symbionts of that symbiont taxon in hosts of that host taxon, or nullptrs.
+ *
+ * Purpose: To find the dominant host-symbiont pair, as sought by the
+ * NO_MUT_UPDATES phase of RunExperiment.
+ */
+std::pair<emp::Ptr<emp::Taxon<int>>, emp::Ptr<emp::Taxon<int>>> SymWorld::GetDominantPair() {
+  taxon_pair_t dominant = pair_taxon_index.GetDominant();
+  return {dominant.first, dominant.second};
+}
+
+
 /**
  * Input: The address of the string representing the suffixes for the files to be created.
  *
@@ -205,18 +410,30 @@ void SymWorld::WritePhylogenyFile(const std::string & filename) {
 
 emp::DataFile & SymWorld::SetUpTransmissionFile(const std::string & filename){
   auto & file = SetupFile(filename);
-  auto & node1 = GetHorizontalTransmissionAttemptCount();
-  auto & node2 = GetHorizontalTransmissionSuccessCount();
-  auto & node3 = GetVerticalTransmissionAttemptCount();
 
   file.AddVar(update, "update", "Update");
 
+  //adaptive rows are unevenly spaced, so say how many updates the totals cover
+  if(my_config->ADAPTIVE_DATA()){
+    last_transmission_row = 0;
+    file.AddCell([this](std::string & out){
+      AppendNumber(out, update - last_transmission_row);
+      last_transmission_row = update;
+    }, "interval", "Number of updates since the previous row, which the totals cover");
+  }
+
   //horizontal transmission
-  file.AddTotal(node1, "attempts_horiztrans", "Total number of horizontal transmission attempts", true);
-  file.AddTotal(node2, "successes_horiztrans", "Total number of horizontal transmission successes", true);
+  if(IsDataEnabled("TransmissionRates", "attempts_horiztrans")){
+    file.AddTotal(GetHorizontalTransmissionAttemptCount(), "attempts_horiztrans", "Total number of horizontal transmission attempts", true);
+  }
+  if(IsDataEnabled("TransmissionRates", "successes_horiztrans")){
+    file.AddTotal(GetHorizontalTransmissionSuccessCount(), "successes_horiztrans", "Total number of horizontal transmission successes", true);
+  }
 
   //vertical transmission
-  file.AddTotal(node3, "attempts_verttrans", "Total number of horizontal transmission attempts", true);
+  if(IsDataEnabled("TransmissionRates", "attempts_verttrans")){
+    file.AddTotal(GetVerticalTransmissionAttemptCount(), "attempts_verttrans", "Total number of horizontal transmission attempts", true);
+  }
 
   file.PrintHeaderKeys();
 
@@ -392,7 +609,7 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymIntValDataNode()
       data_node_symintval->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+          SymList& syms = pop[i]->GetSymbionts();
           size_t sym_size = syms.size();
           for(size_t j=0; j< sym_size; j++){
             data_node_symintval->AddDatum(syms[j]->GetIntVal());
@@ -450,7 +667,7 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymIntValDataN
       data_node_hostedsymintval->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+          SymList& syms = pop[i]->GetSymbionts();
           size_t sym_size = syms.size();
           for(size_t j=0; j< sym_size; j++){
             data_node_hostedsymintval->AddDatum(syms[j]->GetIntVal());
@@ -480,7 +697,7 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetSymInfectChanceDataN
       data_node_syminfectchance->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+          SymList& syms = pop[i]->GetSymbionts();
           size_t sym_size = syms.size();
           for(size_t j=0; j< sym_size; j++){
             data_node_syminfectchance->AddDatum(syms[j]->GetInfectionChance());
@@ -540,7 +757,7 @@ emp::DataMonitor<double,emp::data::Histogram>& SymWorld::GetHostedSymInfectChanc
       data_node_hostedsyminfectchance->Reset();
       for (size_t i = 0; i< pop.size(); i++) {
         if (IsOccupied(i)) {
-          emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+          SymList& syms = pop[i]->GetSymbionts();
           size_t sym_size = syms.size();
           for(size_t j=0; j< sym_size; j++){
             data_node_hostedsyminfectchance->AddDatum(syms[j]->GetInfectionChance());
@@ -0,0 +1,218 @@
+#ifndef DISPERSAL_KERNEL_H
+#define DISPERSAL_KERNEL_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/base/assert.hpp"
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+/**
+ * Walker's alias table, which draws an index with probability proportional
+ * to its weight using one random index and one random double, however many
+ * weights there are. Built in linear time with Vose's method.
+ */
+class AliasTable {
+protected:
+  /**
+    *
+    * Purpose: Represents the chance that a drawn index is kept rather than
+    * replaced by its alias.
+    *
+  */
+  emp::vector<double> keep_chance;
+
+  /**
+    *
+    * Purpose: Represents the index drawn instead of each index when it is not
+    * kept.
+    *
+  */
+  emp::vector<uint32_t> alias;
+
+public:
+  /**
+   * Input: The weights of the indices, which must not be negative and must
+   * not all be 0.
+   *
+   * Output: None
+   *
+   * Purpose: To build the table for a set of weights.
+   */
+  void Build(const emp::vector<double> & weights) {
+    size_t n = weights.size();
+    double total = 0;
+    for (double weight : weights) total += weight;
+    if (n == 0 || !(total > 0)) throw "Alias table weights must have a positive total";
+
+    keep_chance.assign(n, 1.0);
+    alias.resize(n);
+    emp::vector<double> scaled(n);
+    emp::vector<uint32_t> small, large;
+    for (size_t i = 0; i < n; i++) {
+      alias[i] = (uint32_t) i;
+      scaled[i] = weights[i] * n / total;
+      if (scaled[i] < 1.0) small.push_back((uint32_t) i);
+      else large.push_back((uint32_t) i);
+    }
+    //each small index is topped up to 1 by a large one, which becomes small once it has given too much
+    while (!small.empty() && !large.empty()) {
+      uint32_t s = small.back(); small.pop_back();
+      uint32_t l = large.back();
+      keep_chance[s] = scaled[s];
+      alias[s] = l;
+      scaled[l] -= 1.0 - scaled[s];
+      if (scaled[l] < 1.0) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    //whatever is left is 1 up to rounding error
+    for (uint32_t i : small) keep_chance[i] = 1.0;
+    for (uint32_t i : large) keep_chance[i] = 1.0;
+  }
+
+
+  /**
+   * Input: The random number generator.
+   *
+   * Output: A random index.
+   *
+   * Purpose: To draw an index with probability proportional to its weight.
+   */
+  size_t Draw(emp::Random & random) const {
+    emp_assert(alias.size() > 0);
+    size_t i = random.GetUInt((uint32_t) alias.size());
+    return random.GetDouble() < keep_chance[i] ? i : alias[i];
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of indices in the table.
+   *
+   * Purpose: To determine the size of the table.
+   */
+  size_t GetSize() const { return alias.size(); }
+};
+
+
+/**
+ * A distance-based dispersal kernel over the cells of a grid: every offset
+ * within a maximum distance (Euclidean, in cells) of the origin, other than
+ * the origin itself, is weighted by its distance d as
+ *   exponential: exp(-d / scale)
+ *   power_law: d ^ -exponent
+ * and offsets are drawn from an alias table, so long-range dispersal costs
+ * the same as a neighbor lookup. The weights are per cell, so the chance of
+ * dispersing a distance d also grows with the number of cells at that
+ * distance.
+ *
+ * On a hexagonal grid, offsets are axial steps, as in NeighborTable, and
+ * distances are between hexagon centers, so the 6 surrounding cells are at
+ * distance 1.
+ */
+class DispersalKernel {
+protected:
+  /**
+    *
+    * Purpose: Represents the x and y offsets a dispersal can move by.
+    *
+  */
+  emp::vector<int32_t> offset_x;
+  emp::vector<int32_t> offset_y;
+
+  /**
+    *
+    * Purpose: Represents if the offsets are axial steps on a hexagonal grid,
+    * with odd rows shifted half a cell to the right.
+    *
+  */
+  bool hex = false;
+
+  /**
+    *
+    * Purpose: Represents the table used to draw an offset.
+    *
+  */
+  AliasTable table;
+
+public:
+  /**
+   * Input: The kernel (exponential or power_law); the length scale of an
+   * exponential kernel; the exponent of a power law kernel; the maximum
+   * distance in cells; whether the grid is hexagonal.
+   *
+   * Output: None
+   *
+   * Purpose: To build the offsets of a kernel and the table to draw them from.
+   */
+  void Build(const std::string & kernel, double scale, double exponent, int max_distance, bool _hex = false) {
+    if (kernel != "exponential" && kernel != "power_law") {
+      throw "Invalid DISPERSAL_KERNEL. Must be neighbor, exponential or power_law";
+    }
+    if (max_distance < 1) throw "Invalid DISPERSAL_MAX_DIST. Must be at least 1";
+    if (kernel == "exponential" && !(scale > 0)) throw "Invalid DISPERSAL_SCALE. Must be positive";
+
+    hex = _hex;
+    offset_x.clear();
+    offset_y.clear();
+    emp::vector<double> weights;
+    //along a hexagonal row, cells up to 2 / sqrt(3) times the distance away can be within it
+    int reach_x = hex ? 2 * max_distance : max_distance;
+    for (int dy = -max_distance; dy <= max_distance; dy++) {
+      for (int dx = -reach_x; dx <= reach_x; dx++) {
+        int squared = hex ? dx * dx + dx * dy + dy * dy : dx * dx + dy * dy;
+        double distance = std::sqrt((double) squared);
+        if (distance == 0 || distance > max_distance) continue;
+        offset_x.push_back(dx);
+        offset_y.push_back(dy);
+        if (kernel == "exponential") weights.push_back(std::exp(-distance / scale));
+        else weights.push_back(std::pow(distance, -exponent));
+      }
+    }
+    table.Build(weights);
+  }
+
+
+  /**
+   * Input: The cell being dispersed from; the width and height of the grid;
+   * whether the grid wraps around at its edges; the random number generator.
+   *
+   * Output: The cell dispersed to, or size_t(-1) if the dispersal left a
+   * grid that does not wrap.
+   *
+   * Purpose: To draw where an offspring or moving organism lands.
+   */
+  size_t Disperse(size_t cell, size_t width, size_t height, bool wrap, emp::Random & random) const {
+    size_t i = table.Draw(random);
+    int w = (int) width, h = (int) height;
+    int x = (int) (cell % width) + offset_x[i];
+    int y = (int) (cell / width);
+    if (hex) {
+      //the shift of the new row relative to this one depends only on this row's parity
+      int rows = (y & 1) + offset_y[i];
+      x += (rows - (rows & 1)) / 2;
+    }
+    y += offset_y[i];
+    if (wrap) {
+      x = ((x % w) + w) % w;
+      y = ((y % h) + h) % h;
+    } else if (x < 0 || x >= w || y < 0 || y >= h) return (size_t) -1;
+    return (size_t) (x + y * w);
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of offsets a dispersal can move by.
+   *
+   * Purpose: To determine the size of the kernel.
+   */
+  size_t GetNumOffsets() const { return offset_x.size(); }
+};
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef GENOTYPE_TABLE_H
+#define GENOTYPE_TABLE_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/assert.hpp"
+#include "AbundanceIndex.h"
+#include <functional>
+#include <unordered_set>
+
+/**
+ * The trait values of an organism. Traits its class does not have are 0.
+ */
+struct Genotype {
+  double int_val = 0;
+  double infection_chance = 0;
+  double lysis_chance = 0;
+  double induction_chance = 0;
+  double inc_val = 0;
+  double donation = 0;
+  double efficiency = 0;
+
+  bool operator==(const Genotype & other) const {
+    return int_val == other.int_val && infection_chance == other.infection_chance &&
+           lysis_chance == other.lysis_chance && induction_chance == other.induction_chance &&
+           inc_val == other.inc_val && donation == other.donation && efficiency == other.efficiency;
+  }
+};
+
+
+/**
+ * Hashes all of the traits of a genotype.
+ */
+struct GenotypeHash {
+  size_t operator()(const Genotype & genotype) const {
+    size_t h = 0;
+    for (double trait : {genotype.int_val, genotype.infection_chance, genotype.lysis_chance,
+                         genotype.induction_chance, genotype.inc_val, genotype.donation, genotype.efficiency}) {
+      h ^= std::hash<double>()(trait) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    }
+    return h;
+  }
+};
+
+
+/**
+ * The genotypes of a population and the number of organisms of each.
+ *
+ * Each distinct genotype is stored once, at an address that stays valid
+ * while any organism has that genotype. Organisms do not keep a reference to
+ * their entry: since their traits do not change once they are counted, the
+ * entry is found again from their traits when they leave. Mutants add a new
+ * entry or join an existing one, and an entry is removed with the last
+ * organism that has it. The counts are kept in an AbundanceIndex,
+ * so the number of genotypes and the dominant genotype are found without
+ * scanning the population.
+ */
+class GenotypeTable {
+protected:
+  /**
+    *
+    * Purpose: Represents the genotypes with at least one organism.
+    *
+  */
+  std::unordered_set<Genotype, GenotypeHash> genotypes;
+
+  /**
+    *
+    * Purpose: Represents the number of organisms of each genotype.
+    *
+  */
+  AbundanceIndex<const Genotype *> abundance;
+
+  /**
+    *
+    * Purpose: Represents the number of organisms in the table.
+    *
+  */
+  size_t num_orgs = 0;
+
+public:
+  /**
+   * Input: The traits of an organism.
+   *
+   * Output: The genotype entry for those traits.
+   *
+   * Purpose: To add an organism to the count of its genotype, creating the
+   * entry if no other organism has it.
+   */
+  emp::Ptr<const Genotype> Add(const Genotype & traits) {
+    const Genotype * genotype = &*genotypes.insert(traits).first;
+    abundance.Add(genotype);
+    num_orgs++;
+    return genotype;
+  }
+
+
+  /**
+   * Input: The traits of an organism that is leaving the table, which must
+   * be the traits it was added with.
+   *
+   * Output: None
+   *
+   * Purpose: To remove an organism from the count of its genotype, removing
+   * the entry once no organism has it.
+   */
+  void Remove(const Genotype & traits) {
+    auto found = genotypes.find(traits);
+    emp_assert(found != genotypes.end(), "organism traits changed after it was added to its genotype");
+    if (found == genotypes.end()) return;
+    const Genotype * genotype = &*found;
+    abundance.Remove(genotype);
+    num_orgs--;
+    if (abundance.GetCount(genotype) == 0) genotypes.erase(found);
+  }
+
+
+  /**
+   * Input: The traits of an organism.
+   *
+   * Output: The genotype entry for those traits, or nullptr if no organism
+   * in the table has them.
+   *
+   * Purpose: To look up the entry of an organism's genotype.
+   */
+  emp::Ptr<const Genotype> Find(const Genotype & traits) const {
+    auto found = genotypes.find(traits);
+    if (found == genotypes.end()) return nullptr;
+    return &*found;
+  }
+
+
+  /**
+   * Input: A genotype entry.
+   *
+   * Output: The number of organisms with that genotype.
+   *
+   * Purpose: To look up how abundant a genotype is.
+   */
+  size_t GetCount(emp::Ptr<const Genotype> genotype) const { return abundance.GetCount(genotype.Raw()); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The most abundant genotype, or nullptr if the table is empty.
+   *
+   * Purpose: To find the dominant genotype.
+   */
+  emp::Ptr<const Genotype> GetDominant() const { return abundance.GetDominant(); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of organisms with the most abundant genotype.
+   *
+   * Purpose: To look up the abundance of the dominant genotype.
+   */
+  size_t GetDominantCount() const { return abundance.GetMaxCount(); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of distinct genotypes.
+   *
+   * Purpose: To measure genotypic diversity.
+   */
+  size_t GetNumGenotypes() const { return genotypes.size(); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of organisms in the table.
+   *
+   * Purpose: To determine how many organisms the counts cover.
+   */
+  size_t GetNumOrgs() const { return num_orgs; }
+
+  std::unordered_set<Genotype, GenotypeHash>::const_iterator begin() const { return genotypes.begin(); }
+  std::unordered_set<Genotype, GenotypeHash>::const_iterator end() const { return genotypes.end(); }
+};
+
+#endif
@@ -8,9 +8,14 @@
 #include <string>
 #include "../Organism.h"
 #include "SymWorld.h"
+#include "ObjectCensus.h"
+#include "SymList.h"
+#include "SymContext.h"
+#include "ResourceKernel.h"
+#include "TraitValue.h"
 
 
-class Host: public Organism {
+class Host: public Organism, public CensusCounter<Host> {
 
 
 protected:
@@ -22,7 +27,7 @@ protected:
     * one represents mutualism. Zero is a neutral value.
     *
   */
-  double interaction_val = 0;
+  TraitValue interaction_val = 0;
 
   /**
     *
@@ -37,9 +42,11 @@ protected:
     * Purpose: Represents the set of symbionts belonging to a host.
     * This can be set with SetSymbionts(), and symbionts can be
     * added with AddSymbiont(). This can be cleared with ClearSyms()
+    * A single symbiont is stored inline, without a heap allocation, and
+    * longer lists use blocks from the world's pool.
     *
   */
-  emp::vector<emp::Ptr<Organism>> syms = {};
+  SymList syms;
 
   /**
     *
@@ -47,7 +54,7 @@ protected:
     * Symbionts can be added with AddReproSymb(). This can be cleared with ClearSyms()
     *
   */
-  emp::vector<emp::Ptr<Organism>> repro_syms = {};
+  SymList repro_syms;
 
   /**
     *
@@ -67,31 +74,34 @@ protected:
 
   /**
     *
-    * Purpose: Represents an instance of random.
+    * Purpose: Represents the random number generator, world and configuration
+    * settings, owned by the world and shared with its other organisms.
     *
   */
-  emp::Ptr<emp::Random> random = NULL;
+  emp::Ptr<SymContext> context = nullptr;
 
   /**
     *
-    * Purpose: Represents the world that the hosts are living in.
+    * Purpose: Represents if a host is alive. This is set to true when a host is killed.
     *
   */
-  emp::Ptr<SymWorld> my_world = NULL;
+  bool dead = false;
 
   /**
     *
-    * Purpose: Represents the configuration settings for a particular run.
+    * Purpose: Represents if the host is counted in its world's genotype
+    * table. It sits beside dead, so it adds nothing to the host's size.
     *
   */
-  emp::Ptr<SymConfigBase> my_config = NULL;
+  bool in_genotypes = false;
 
   /**
     *
-    * Purpose: Represents if a host is alive. This is set to true when a host is killed.
+    * Purpose: Tracks the taxon of this host once it is placed in a world that
+    * uses the full phylogeny tracker.
     *
   */
-  bool dead = false;
+  emp::Ptr<emp::Taxon<int>> my_taxon = nullptr;
 
 public:
 
@@ -101,7 +111,7 @@ public:
   Host(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config,
   double _intval =0.0, emp::vector<emp::Ptr<Organism>> _syms = {},
   emp::vector<emp::Ptr<Organism>> _repro_syms = {},
-  double _points = 0.0) : interaction_val(_intval), syms(_syms), repro_syms(_repro_syms), points(_points), random(_random), my_world(_world), my_config(_config) {
+  double _points = 0.0) : interaction_val(_intval), syms(_syms), repro_syms(_repro_syms), points(_points), context(_world->GetContext(_random, _config)) {
     if ( _intval > 1 || _intval < -1) {
        throw "Invalid interaction value. Must be between -1 and 1";  // Exception for invalid interaction value
      };
@@ -121,6 +131,8 @@ public:
     for(size_t j=0; j<repro_syms.size(); j++){
       repro_syms[j].Delete();
     }
+    syms.clear(GetSymListPool());
+    repro_syms.clear(GetSymListPool());
   }
 
 
@@ -206,6 +218,38 @@ public:
     return "Host";
   }
 
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the host's state, and that of its symbionts in order, to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    hasher.Add((double) interaction_val);
+    hasher.Add(points);
+    hasher.Add(res_in_process);
+    hasher.Add(age);
+    hasher.Add(dead);
+    hasher.Add(syms.size());
+    for (emp::Ptr<Organism> sym : syms) sym->AddToDigest(hasher);
+    hasher.Add(repro_syms.size());
+    for (emp::Ptr<Organism> sym : repro_syms) sym->AddToDigest(hasher);
+  }
+
+
+  /**
+  * Input: The genotype being built.
+  *
+  * Output: None
+  *
+  * Purpose: To add the host's traits to its genotype.
+  */
+  void AddToGenotype(Genotype & _genotype) {
+    _genotype.int_val = interaction_val;
+  }
+
 /**
   * Input: None
   *
@@ -219,21 +263,52 @@ public:
 /**
   * Input: None
   *
-  * Output: A vector of pointers to the organisms that are the host's syms.
+  * Output: A list of pointers to the organisms that are the host's syms.
   *
-  * Purpose: To get the vector containing pointers to the host's symbionts.
+  * Purpose: To get the list containing pointers to the host's symbionts.
   */
-  emp::vector<emp::Ptr<Organism>>& GetSymbionts() {return syms;}
+  SymList& GetSymbionts() {return syms;}
+
+
+/**
+ * Input: None
+ *
+ * Output: A list of pointers to the organisms that are the host's repro syms.
+ *
+ * Purpose: To get the list containing pointers to the host's repro syms.
+ */
+  SymList& GetReproSymbionts() {return repro_syms;}
 
 
 /**
  * Input: None
  *
- * Output: A vector of pointers to the organisms that are the host's repro syms.
+ * Output: The pool of symbiont list blocks of the host's world.
  *
- * Purpose: To get the vector containing pointers to the host's repro syms.
+ * Purpose: To find where the blocks of the host's symbiont lists come from
+ * and go back to.
  */
-  emp::vector<emp::Ptr<Organism>>& GetReproSymbionts() {return repro_syms;}
+  emp::Ptr<SymListPool> GetSymListPool() {return &context->world->GetSymListPool();}
+
+
+  /**
+   * Input: None
+   *
+   * Output: The pointer to the host's taxon, or nullptr if it has not been placed
+   *
+   * Purpose: To retrieve the host's taxon
+   */
+  emp::Ptr<emp::Taxon<int>> GetTaxon() {return my_taxon;}
+
+
+  /**
+   * Input: A pointer to the taxon that this host belongs to.
+   *
+   * Output: None
+   *
+   * Purpose: To set the host's taxon
+   */
+  void SetTaxon(emp::Ptr<emp::Taxon<int>> _in) {my_taxon = _in;}
 
 
   /**
@@ -313,7 +388,7 @@ public:
    *
    * Purpose: To clear a host's symbionts.
    */
-  void ClearSyms() {syms.resize(0);}
+  void ClearSyms() {syms.resize(0, GetSymListPool());}
 
 
   /**
@@ -323,7 +398,7 @@ public:
    *
    * Purpose: To clear a host's repro symbionts.
    */
-  void ClearReproSyms() {repro_syms.resize(0);}
+  void ClearReproSyms() {repro_syms.resize(0, GetSymListPool());}
 
 
   /**
@@ -336,6 +411,26 @@ public:
   void SetDead() { dead = true;}
 
 
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the host is counted in the genotype table.
+   *
+   * Purpose: To know if the host must be removed from the genotype table.
+   */
+  bool IsInGenotypes() { return in_genotypes; }
+
+
+  /**
+   * Input: The bool representing if the host is counted in the genotype table.
+   *
+   * Output: None
+   *
+   * Purpose: To record when the host is added to or removed from the genotype table.
+   */
+  void SetInGenotypes(bool _in) { in_genotypes = _in; }
+
+
   /**
    * Input: The double to be set as res_in_process
    *
@@ -381,7 +476,7 @@ public:
    */
   void GrowOlder(){
     age = age + 1;
-    if(age > my_config->HOST_AGE_MAX() && my_config->HOST_AGE_MAX() > 0){
+    if(age > context->config->HOST_AGE_MAX() && context->config->HOST_AGE_MAX() > 0){
       SetDead();
     }
   }
@@ -435,8 +530,8 @@ public:
    * Purpose: To add a symbionts to a host's symbionts
    */
   int AddSymbiont(emp::Ptr<Organism> _in) {
-    if((int)syms.size() < my_config->SYM_LIMIT() && SymAllowedIn()){
-      syms.push_back(_in);
+    if((int)syms.size() < context->config->SYM_LIMIT() && SymAllowedIn()){
+      syms.push_back(_in, GetSymListPool());
       _in->SetHost(this);
       _in->UponInjection();
       return syms.size();
@@ -457,14 +552,14 @@ public:
    * where n is the number of existing phage.
    */
   bool SymAllowedIn(){
-    bool do_phage_exclusion = my_config->PHAGE_EXCLUDE();
+    bool do_phage_exclusion = context->config->PHAGE_EXCLUDE();
     if(!do_phage_exclusion){
      return true;
     }
     else{
      int num_syms = syms.size();
      //essentially imitaties a 1/ 2^n chance, with n = number of symbionts
-     int enter_chance = random->GetUInt((int) pow(2.0, num_syms));
+     int enter_chance = context->random->GetUInt((int) pow(2.0, num_syms));
      if(enter_chance == 0) { return true; }
      return false;
     }
@@ -478,7 +573,7 @@ public:
    *
    * Purpose: To add a repro sym to the host's symbionts.
    */
-  void AddReproSym(emp::Ptr<Organism> _in) {repro_syms.push_back(_in);}
+  void AddReproSym(emp::Ptr<Organism> _in) {repro_syms.push_back(_in, GetSymListPool());}
 
 
   /**
@@ -500,7 +595,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<Host> new_host = emp::NewPtr<Host>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Host> new_host = emp::NewPtr<Host>(context->random, context->world, context->config, GetIntVal());
     return new_host;
   }
 
@@ -527,13 +622,13 @@ public:
    * hosts to allow for evolution to occur.
    */
   void Mutate(){
-    double mutation_size = my_config->HOST_MUTATION_SIZE();
-    if (mutation_size == -1) mutation_size = my_config->MUTATION_SIZE();
-    double mutation_rate = my_config->HOST_MUTATION_RATE();
-    if (mutation_rate == -1) mutation_rate = my_config->MUTATION_RATE();
+    double mutation_size = context->config->HOST_MUTATION_SIZE();
+    if (mutation_size == -1) mutation_size = context->config->MUTATION_SIZE();
+    double mutation_rate = context->config->HOST_MUTATION_RATE();
+    if (mutation_rate == -1) mutation_rate = context->config->MUTATION_RATE();
 
-    if(random->GetDouble(0.0, 1.0) <= mutation_rate){
-      interaction_val += random->GetRandNormal(0.0, mutation_size);
+    if(context->random->GetDouble(0.0, 1.0) <= mutation_rate){
+      interaction_val += context->random->GetRandNormal(0.0, mutation_size);
       if(interaction_val < -1) interaction_val = -1;
       else if (interaction_val > 1) interaction_val = 1;
     }
@@ -547,7 +642,9 @@ public:
    *
    * Purpose: To distribute resources to a host and its symbionts. In the event that the host has no symbionts,
    * the host gets all resources not allocated to defense or given to absent partner. Otherwise, the resource
-   * is split into equal chunks for each symbiont
+   * is split into equal chunks for each symbiont. The shares of symbionts that use Symbiont::ProcessResources
+   * are computed with ResourceKernel::DistribPair, which replaces the calls to ProcessResources and
+   * StealResources; the points are still added with AddPoints.
    */
   void DistribResources(double resources) {
     double hostIntVal = interaction_val; //using private variable because we can
@@ -570,8 +667,16 @@ public:
     size_t num_sym = syms.size();
     double sym_piece = (double) resources / num_sym;
 
+    double synergy = context->config->SYNERGY();
+
     for(size_t i=0; i < syms.size(); i++){
-      DistribResToSym(syms[i], sym_piece);
+      if(syms[i]->HasDefaultResourceProcessing()){
+        double host_gain, sym_gain;
+        syms[i]->GetPayoff(hostIntVal, sym_piece, synergy, host_gain, sym_gain);
+        syms[i]->AddPoints(sym_gain);
+        this->AddPoints(host_gain);
+      }
+      else DistribResToSym(syms[i], sym_piece);
     }
   } //end DistribResources
 
@@ -586,7 +691,7 @@ public:
     double leftover_resources = resources;
     if(GetDoEctosymbiosis(location)){
       double sym_piece = leftover_resources / (syms.size() + 1); //if there are no endo syms, the ecto sym will handle all the resources
-      DistribResToSym(my_world->GetSymAt(location), sym_piece);
+      DistribResToSym(context->world->GetSymAt(location), sym_piece);
       leftover_resources = leftover_resources - sym_piece; //leave the leftover resources to be split by other syms
     }
     return leftover_resources;
@@ -601,10 +706,10 @@ public:
    */
   bool GetDoEctosymbiosis(size_t location){
     //a host is immune to ectosymbiosis if immunity is on and it has a sym.
-    if (!my_config->ECTOSYMBIOSIS()) return false; //if the config setting is off, we immediately know that ectosymbiosis won't happen
+    if (!context->config->ECTOSYMBIOSIS()) return false; //if the config setting is off, we immediately know that ectosymbiosis won't happen
     else{
-      bool is_immune = my_config->ECTOSYMBIOTIC_IMMUNITY() && HasSym();
-      bool valid_sym = my_world->GetSymAt(location) != nullptr && !my_world->GetSymAt(location)->GetDead();
+      bool is_immune = context->config->ECTOSYMBIOTIC_IMMUNITY() && HasSym();
+      bool valid_sym = context->world->GetSymAt(location) != nullptr && !context->world->GetSymAt(location)->GetDead();
       return (valid_sym == true) && (is_immune == false);
     }
   }
@@ -645,13 +750,13 @@ public:
   void Process(emp::WorldPosition pos) {
     size_t location = pos.GetIndex();
     //Currently just wrapping to use the existing function
-    double desired_resources = my_config->RES_DISTRIBUTE();
-    double world_resources = my_world->PullResources(desired_resources); //recieve resources from the world
+    double desired_resources = context->config->RES_DISTRIBUTE();
+    double world_resources = context->world->PullResources(desired_resources); //recieve resources from the world
     double resources = HandleEctosymbiosis(world_resources, location);
     if(resources > 0) DistribResources(resources); //if there are enough resources left, distribute them.
 
     // Check reproduction
-    if (GetPoints() >= my_config->HOST_REPRO_RES() && repro_syms.size() == 0) {  // if host has more points than required for repro
+    if (GetPoints() >= context->config->HOST_REPRO_RES() && repro_syms.size() == 0) {  // if host has more points than required for repro
         // will replicate & mutate a random offset from parent values
         // while resetting resource points for host and symbiont to zero
        emp::Ptr<Organism> host_baby = Reproduce();
@@ -661,13 +766,13 @@ public:
           emp::Ptr<Organism> parent = GetSymbionts()[j];
           parent->VerticalTransmission(host_baby);
         }
-        my_world->DoBirth(host_baby, location); //Automatically deals with grid
+        context->world->DoBirth(host_baby, location); //Automatically deals with grid
       }
     if (GetDead()){
         return; //If host is dead, return
       }
     if (HasSym()) { //let each sym do whatever they need to do
-        emp::vector<emp::Ptr<Organism>>& syms = GetSymbionts();
+        SymList& syms = GetSymbionts();
         for(size_t j = 0; j < syms.size(); j++){
           emp::Ptr<Organism> curSym = syms[j];
           if (GetDead()){
@@ -680,7 +785,12 @@ public:
             curSym->Process(sym_pos);
           }
           if(curSym->GetDead()){
-            syms.erase(syms.begin() + j); //if the symbiont dies during their process, remove from syms list
+            //if the symbiont dies during their process, remove from syms list
+            if(context->config->SYM_SWAP_REMOVE()){
+              syms.SwapRemove(j);
+              j--; //the last symbiont now sits at j, so process it next
+            }
+            else syms.erase(syms.begin() + j);
             curSym.Delete();
           }
         } //for each sym in syms
@@ -0,0 +1,321 @@
+#ifndef LINEAGE_PHYLOGENY_H
+#define LINEAGE_PHYLOGENY_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+
+/**
+ * A compact genotype-level phylogeny.
+ *
+ * Each node is a genotype, identified by its trait value (such as the
+ * interaction value), and stores the index of its parent node, the update it
+ * arose and its trait in packed parallel arrays. An offspring with the same
+ * trait as its parent joins the parent's node, so only mutations create nodes.
+ *
+ * Nodes with no living organisms stay in the tree while they have living
+ * descendants. Prune marks every node on the ancestry of a living organism
+ * and frees the rest, whose slots are reused by later nodes, so the indices
+ * of surviving nodes never change.
+ */
+class LineagePhylogeny {
+public:
+  /**
+   * Purpose: Represents a missing node, for the parent of a root and for
+   * empty positions.
+   */
+  static constexpr uint32_t NO_NODE = std::numeric_limits<uint32_t>::max();
+
+protected:
+  /**
+    *
+    * Purpose: Represents the parent node, the update it arose, the update
+    * its last organism died (NO_NODE while it has living organisms), the
+    * trait value, and the number of living organisms of each node.
+    *
+  */
+  emp::vector<uint32_t> parent;
+  emp::vector<uint32_t> birth_update;
+  emp::vector<uint32_t> death_update;
+  emp::vector<float> trait;
+  emp::vector<uint32_t> num_orgs;
+
+  /**
+    *
+    * Purpose: Represents whether each node slot is in use.
+    *
+  */
+  emp::vector<bool> in_use;
+
+  /**
+    *
+    * Purpose: Represents the slots freed by pruning, to be reused by new nodes.
+    *
+  */
+  emp::vector<uint32_t> free_nodes;
+
+  /**
+    *
+    * Purpose: Represents the node of the organism at each world position,
+    * for organisms tracked by position.
+    *
+  */
+  emp::vector<uint32_t> position_nodes;
+
+  /**
+   * Input: The trait value; the parent node; the current update.
+   *
+   * Output: The index of the new node.
+   *
+   * Purpose: To create a node, reusing a freed slot if there is one.
+   */
+  uint32_t NewNode(float node_trait, uint32_t node_parent, size_t update) {
+    uint32_t id;
+    if (free_nodes.size()) {
+      id = free_nodes.back();
+      free_nodes.pop_back();
+    } else {
+      id = parent.size();
+      parent.push_back(NO_NODE);
+      birth_update.push_back(0);
+      death_update.push_back(NO_NODE);
+      trait.push_back(0);
+      num_orgs.push_back(0);
+      in_use.push_back(false);
+    }
+    parent[id] = node_parent;
+    birth_update[id] = update;
+    death_update[id] = NO_NODE;
+    trait[id] = node_trait;
+    num_orgs[id] = 0;
+    in_use[id] = true;
+    return id;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The vector of bools representing which nodes are on the ancestry
+   * of a living organism.
+   *
+   * Purpose: To find the surviving tree. Each walk up from a living node
+   * stops at the first node already marked, so every node is visited once.
+   */
+  emp::vector<bool> Mark() const {
+    emp::vector<bool> marked(parent.size(), false);
+    for (size_t id = 0; id < parent.size(); id++) {
+      if (!in_use[id] || num_orgs[id] == 0) continue;
+      uint32_t cur = id;
+      while (cur != NO_NODE && !marked[cur]) {
+        marked[cur] = true;
+        cur = parent[cur];
+      }
+    }
+    return marked;
+  }
+
+public:
+  /**
+   * Input: The trait of the new organism; the node of its parent, or NO_NODE;
+   * the current update.
+   *
+   * Output: The node the organism was added to.
+   *
+   * Purpose: To record the birth of an organism.
+   */
+  size_t AddOrg(double org_trait, size_t parent_node, size_t update) {
+    float packed_trait = org_trait;
+    uint32_t id;
+    if (parent_node != NO_NODE && trait[parent_node] == packed_trait) id = parent_node;
+    else id = NewNode(packed_trait, parent_node, update);
+    num_orgs[id]++;
+    death_update[id] = NO_NODE;
+    return id;
+  }
+
+
+  /**
+   * Input: The node of the organism; the current update; optionally the number
+   * of organisms of the node that died.
+   *
+   * Output: None
+   *
+   * Purpose: To record the death of one or more organisms of a genotype. The
+   * node is kept until the next Prune.
+   */
+  void RemoveOrg(size_t node, size_t update, size_t count=1) {
+    if (node >= num_orgs.size() || num_orgs[node] == 0) return;
+    num_orgs[node] -= std::min<size_t>(count, num_orgs[node]);
+    if (num_orgs[node] == 0) death_update[node] = update;
+  }
+
+
+  /**
+   * Input: The world position of the new organism; its trait; the node of its
+   * parent, or NO_NODE; the current update.
+   *
+   * Output: None
+   *
+   * Purpose: To record the birth of an organism tracked by position. Any
+   * organism already recorded at the position is removed first.
+   */
+  void AddOrgAt(size_t pos, double org_trait, size_t parent_node, size_t update) {
+    RemoveOrgAt(pos, update);
+    if (pos >= position_nodes.size()) position_nodes.resize(pos + 1, NO_NODE);
+    position_nodes[pos] = AddOrg(org_trait, parent_node, update);
+  }
+
+
+  /**
+   * Input: The world position of the organism; the current update.
+   *
+   * Output: None
+   *
+   * Purpose: To record the death of an organism tracked by position.
+   */
+  void RemoveOrgAt(size_t pos, size_t update) {
+    if (pos >= position_nodes.size() || position_nodes[pos] == NO_NODE) return;
+    RemoveOrg(position_nodes[pos], update);
+    position_nodes[pos] = NO_NODE;
+  }
+
+
+  /**
+   * Input: The world position.
+   *
+   * Output: The node of the organism at the position, or NO_NODE.
+   *
+   * Purpose: To look up the node of an organism tracked by position.
+   */
+  size_t GetNodeAt(size_t pos) const {
+    if (pos >= position_nodes.size()) return NO_NODE;
+    return position_nodes[pos];
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of nodes pruned.
+   *
+   * Purpose: To free every node that is not on the ancestry of a living
+   * organism.
+   */
+  size_t Prune() {
+    emp::vector<bool> marked = Mark();
+    size_t num_pruned = 0;
+    for (size_t id = 0; id < parent.size(); id++) {
+      if (in_use[id] && !marked[id]) {
+        in_use[id] = false;
+        free_nodes.push_back(id);
+        num_pruned++;
+      }
+    }
+    return num_pruned;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of nodes in use.
+   *
+   * Purpose: To determine the size of the stored tree.
+   */
+  size_t GetNumNodes() const { return parent.size() - free_nodes.size(); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of node slots allocated.
+   *
+   * Purpose: To determine the memory used by the packed arrays.
+   */
+  size_t GetCapacity() const { return parent.size(); }
+
+
+  /**
+   * Input: A node.
+   *
+   * Output: The number of living organisms with the node's genotype.
+   *
+   * Purpose: To retrieve the size of a genotype.
+   */
+  size_t GetNumOrgs(size_t node) const { return num_orgs[node]; }
+
+
+  /**
+   * Input: A node.
+   *
+   * Output: The parent node, or NO_NODE.
+   *
+   * Purpose: To walk up a lineage.
+   */
+  size_t GetParent(size_t node) const { return parent[node]; }
+
+
+  /**
+   * Input: A node.
+   *
+   * Output: The trait value of the node's genotype.
+   *
+   * Purpose: To retrieve the genotype of a node.
+   */
+  double GetTrait(size_t node) const { return trait[node]; }
+
+
+  /**
+   * Input: A node.
+   *
+   * Output: The update the node's genotype arose.
+   *
+   * Purpose: To retrieve the origination time of a node.
+   */
+  size_t GetOriginationTime(size_t node) const { return birth_update[node]; }
+
+
+  /**
+   * Input: A node.
+   *
+   * Output: The update the node's last organism died, or NO_NODE if it has
+   * living organisms.
+   *
+   * Purpose: To retrieve the destruction time of a node.
+   */
+  size_t GetDestructionTime(size_t node) const { return death_update[node]; }
+
+
+  /**
+   * Input: The path of the file to write.
+   *
+   * Output: None
+   *
+   * Purpose: To write the surviving tree, one row per node. The id,
+   * ancestor_list, origin_time, destruction_time and num_orgs columns are
+   * those of emp::Systematics::Snapshot, in the same order, with
+   * destruction_time "inf" for genotypes that are still alive. Its offspring
+   * and depth columns are left out, since they are not tracked. The info
+   * column is the trait value.
+   */
+  void Snapshot(const std::string & file_path) const {
+    std::ofstream out(file_path);
+    out << "id,ancestor_list,origin_time,destruction_time,num_orgs,info\n";
+    emp::vector<bool> marked = Mark();
+    for (size_t id = 0; id < parent.size(); id++) {
+      if (!in_use[id] || !marked[id]) continue;
+      out << id << ',';
+      if (parent[id] == NO_NODE) out << "[NONE]";
+      else out << '[' << parent[id] << ']';
+      out << ',' << birth_update[id] << ',';
+      if (death_update[id] == NO_NODE) out << "inf";
+      else out << death_update[id];
+      out << ',' << num_orgs[id] << ',' << trait[id] << '\n';
+    }
+  }
+};
+
+#endif
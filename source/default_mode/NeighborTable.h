@@ -0,0 +1,295 @@
+#ifndef NEIGHBOR_TABLE_H
+#define NEIGHBOR_TABLE_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/base/assert.hpp"
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+
+/**
+ * The neighborhood of every cell of a grid, precomputed so that finding a
+ * random neighbor is one random index into the cell's neighborhood instead
+ * of working out which offsets fall on the grid.
+ *
+ * A neighborhood holds the cells within a radius of a cell, including the
+ * cell itself, as Empirical's grid does:
+ *   moore: square cells within the radius in both directions (the 8
+ *     surrounding cells and the cell itself for a radius of 1).
+ *   von_neumann: square cells within the radius in steps up, down, left or
+ *     right.
+ *   hex: hexagonal cells within the radius, with odd rows shifted half a
+ *     cell to the right.
+ * Grids either wrap around at their edges (a torus), or are bounded, so that
+ * cells near an edge have fewer neighbors. On a wrapping grid narrower than
+ * a neighborhood, a cell reached by more than one offset appears once per
+ * offset, as it does in Empirical's grid.
+ *
+ * Every cell of a wrapping grid has the same offsets (one list for even rows
+ * and one for odd rows on hexagonal grids), so only the offsets are stored
+ * and they are wrapped onto the grid on lookup. On a bounded grid, cells
+ * whose whole neighborhood is on the grid use the offsets too, and only the
+ * cells near an edge have their neighbors listed, so the table grows with
+ * the number of cells and not with the size of a neighborhood as well.
+ *
+ * Offsets are stored in the order Empirical draws them in (row by row, left
+ * to right) and drawn from the same way, so a radius 1 moore neighborhood on
+ * a wrapping grid picks the same neighbor as Empirical's grid for the same
+ * random number generator state.
+ */
+class NeighborTable {
+public:
+  /**
+   * A step from a cell to one of its neighbors.
+   */
+  struct Offset {
+    int32_t dx;
+    int32_t dy;
+  };
+
+  /**
+   * The neighbors of one cell, for iteration. They are either listed, for
+   * cells near the edge of a bounded grid, or found from the offsets.
+   */
+  struct Neighbors {
+    const NeighborTable * table;
+    int x;
+    int y;
+    const Offset * offsets;
+    const uint32_t * cells;
+    size_t count;
+
+    struct iterator {
+      using iterator_category = std::input_iterator_tag;
+      using value_type = uint32_t;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const uint32_t *;
+      using reference = uint32_t;
+
+      const Neighbors * neighbors;
+      size_t i;
+      uint32_t operator*() const { return (*neighbors)[i]; }
+      iterator & operator++() { i++; return *this; }
+      bool operator==(const iterator & other) const { return i == other.i; }
+      bool operator!=(const iterator & other) const { return i != other.i; }
+    };
+
+    uint32_t operator[](size_t i) const {
+      if (cells) return cells[i];
+      return table->OffsetCell(x, y, offsets[i]);
+    }
+    iterator begin() const { return {this, 0}; }
+    iterator end() const { return {this, count}; }
+    size_t size() const { return count; }
+  };
+
+protected:
+  /**
+    *
+    * Purpose: Represents the offsets of a neighborhood: [0] for every cell,
+    * or for cells in even rows on hexagonal grids, and [1] for cells in odd
+    * rows on hexagonal grids.
+    *
+  */
+  emp::vector<Offset> offsets[2];
+
+  /**
+    *
+    * Purpose: Represents the neighbors of the cells near the edges of a
+    * bounded grid, one cell after another. Empty on wrapping grids.
+    *
+  */
+  emp::vector<uint32_t> neighbors;
+
+  /**
+    *
+    * Purpose: Represents where each cell's neighbors start in neighbors on a
+    * bounded grid, with a final entry for the end of the last cell. A cell
+    * with no neighbors listed uses the offsets. Empty on wrapping grids.
+    *
+  */
+  emp::vector<uint32_t> row_starts;
+
+  /**
+    *
+    * Purpose: Represents the grid the table was built for.
+    *
+  */
+  size_t width = 0;
+  size_t height = 0;
+  std::string topology;
+  int radius = 0;
+  bool wrap = true;
+  bool hex = false;
+
+  /**
+   * Input: The row of a cell.
+   *
+   * Output: The offsets of the cell's neighborhood.
+   *
+   * Purpose: To pick the offsets for a cell's row.
+   */
+  const emp::vector<Offset> & GetOffsets(int y) const { return offsets[hex && (y & 1)]; }
+
+public:
+  /**
+   * Input: The x and y coordinates of a cell; an offset from it.
+   *
+   * Output: The cell the offset reaches, wrapped onto the grid if the grid
+   * wraps.
+   *
+   * Purpose: To find a neighbor from an offset.
+   */
+  uint32_t OffsetCell(int x, int y, Offset offset) const {
+    int w = (int) width, h = (int) height;
+    x += offset.dx;
+    y += offset.dy;
+    if (wrap) {
+      x = ((x % w) + w) % w;
+      y = ((y % h) + h) % h;
+    }
+    return (uint32_t) (x + y * w);
+  }
+
+
+  /**
+   * Input: The width and height of the grid; the topology (moore,
+   * von_neumann or hex); the radius of a neighborhood; whether the grid
+   * wraps around at its edges.
+   *
+   * Output: None
+   *
+   * Purpose: To build the neighborhood of every cell. Nothing is rebuilt if
+   * the table already matches.
+   */
+  void Build(size_t _width, size_t _height, const std::string & _topology, int _radius, bool _wrap) {
+    if (_width == width && _height == height && _topology == topology && _radius == radius && _wrap == wrap) return;
+    if (_topology != "moore" && _topology != "von_neumann" && _topology != "hex") {
+      throw "Invalid GRID_TOPOLOGY. Must be moore, von_neumann or hex";
+    }
+    if (_radius < 1) throw "Invalid GRID_RADIUS. Must be at least 1";
+    if (_topology == "hex" && _wrap && _height % 2) throw "Hexagonal grids that wrap need an even GRID_Y";
+
+    width = _width;
+    height = _height;
+    topology = _topology;
+    radius = _radius;
+    wrap = _wrap;
+    hex = topology == "hex";
+    offsets[0].clear();
+    offsets[1].clear();
+    neighbors.clear();
+    row_starts.clear();
+
+    for (int parity = 0; parity < (hex ? 2 : 1); parity++) {
+      for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+          if (topology == "moore") offsets[parity].push_back({dx, dy});
+          else if (topology == "von_neumann") {
+            if (std::abs(dx) + std::abs(dy) <= radius) offsets[parity].push_back({dx, dy});
+          } else {
+            //dx and dy are axial offsets; the third cube coordinate must be within the radius too
+            if (std::abs(dx + dy) > radius) continue;
+            //the shift of the neighbor's row relative to the cell's depends only on the cell's row parity
+            int rows = parity + dy;
+            offsets[parity].push_back({dx + (rows - (rows & 1)) / 2, dy});
+          }
+        }
+      }
+    }
+    if (wrap) return;
+
+    //on a bounded grid, list the neighbors of cells whose neighborhood runs off the grid
+    int w = (int) width, h = (int) height;
+    size_t num_cells = width * height;
+    row_starts.reserve(num_cells + 1);
+    for (size_t cell = 0; cell < num_cells; cell++) {
+      row_starts.push_back((uint32_t) neighbors.size());
+      int x = (int) (cell % width), y = (int) (cell / width);
+      const emp::vector<Offset> & cell_offsets = GetOffsets(y);
+      bool on_grid = true;
+      for (Offset offset : cell_offsets) {
+        int nx = x + offset.dx, ny = y + offset.dy;
+        if (nx < 0 || nx >= w || ny < 0 || ny >= h) { on_grid = false; break; }
+      }
+      if (on_grid) continue;
+      for (Offset offset : cell_offsets) {
+        int nx = x + offset.dx, ny = y + offset.dy;
+        if (nx >= 0 && nx < w && ny >= 0 && ny < h) neighbors.push_back(OffsetCell(x, y, offset));
+      }
+    }
+    row_starts.push_back((uint32_t) neighbors.size());
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of cells in the table, or 0 if it has not been built.
+   *
+   * Purpose: To determine whether the table covers a world.
+   */
+  size_t GetNumCells() const { return width * height; }
+
+
+  /**
+   * Input: A cell.
+   *
+   * Output: The cell's neighbors.
+   *
+   * Purpose: To iterate over a cell's neighborhood.
+   */
+  Neighbors GetNeighbors(size_t cell) const {
+    emp_assert(cell < GetNumCells(), cell, GetNumCells());
+    int x = (int) (cell % width), y = (int) (cell / width);
+    if (!row_starts.empty() && row_starts[cell] != row_starts[cell + 1]) {
+      return {this, x, y, nullptr, neighbors.data() + row_starts[cell], row_starts[cell + 1] - row_starts[cell]};
+    }
+    const emp::vector<Offset> & cell_offsets = GetOffsets(y);
+    return {this, x, y, cell_offsets.data(), nullptr, cell_offsets.size()};
+  }
+
+
+  /**
+   * Input: A cell; the random number generator.
+   *
+   * Output: A random cell of the cell's neighborhood, or the cell itself if
+   * its neighborhood is empty.
+   *
+   * Purpose: To pick a random neighbor with a single random draw, made with
+   * GetInt as Empirical's grid makes it.
+   */
+  size_t GetRandomNeighbor(size_t cell, emp::Random & random) const {
+    Neighbors row = GetNeighbors(cell);
+    if (!row.size()) return cell;
+    return row[random.GetInt((int) row.size())];
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: Whether the neighborhoods are Empirical's own: radius 1 moore
+   * neighborhoods on a wrapping grid.
+   *
+   * Purpose: To know when Empirical's neighbor functions can be used as they are.
+   */
+  bool IsEmpiricalGrid() const { return topology == "moore" && radius == 1 && wrap; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of bytes held by the table.
+   *
+   * Purpose: To measure memory.
+   */
+  size_t GetBytes() const {
+    return (offsets[0].capacity() + offsets[1].capacity()) * sizeof(Offset)
+      + (neighbors.capacity() + row_starts.capacity()) * sizeof(uint32_t);
+  }
+};
+
+#endif
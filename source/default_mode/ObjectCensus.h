@@ -0,0 +1,86 @@
+#ifndef OBJECT_CENSUS_H
+#define OBJECT_CENSUS_H
+
+#include <cstddef>
+
+#ifndef __EMSCRIPTEN__
+#include <sys/resource.h>
+#endif
+
+/**
+ * Counts the objects of a class that are constructed and destroyed.
+ *
+ * A class is counted by inheriting from CensusCounter of itself, e.g.
+ * `class Host: public Organism, public CensusCounter<Host>`. The base is
+ * empty, so counted objects are no larger. A subclass of a counted class is
+ * counted under both, so a Bacterium is also a Host. Counts are shared by
+ * every world in the process.
+ */
+template <typename T>
+class CensusCounter {
+  static inline size_t num_births = 0;
+  static inline size_t num_deletions = 0;
+
+protected:
+  CensusCounter() { num_births++; }
+  CensusCounter(const CensusCounter &) { num_births++; }
+  CensusCounter(CensusCounter &&) { num_births++; }
+  CensusCounter & operator=(const CensusCounter &) = default;
+  CensusCounter & operator=(CensusCounter &&) = default;
+  ~CensusCounter() { num_deletions++; }
+
+public:
+  /**
+   * Input: None
+   *
+   * Output: The number of objects of the class ever constructed.
+   *
+   * Purpose: To count births.
+   */
+  static size_t GetNumBirths() { return num_births; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of objects of the class ever destroyed.
+   *
+   * Purpose: To count deletions.
+   */
+  static size_t GetNumDeletions() { return num_deletions; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of objects of the class currently alive.
+   *
+   * Purpose: To count live objects and catch leaks.
+   */
+  static size_t GetNumLive() { return num_births - num_deletions; }
+};
+
+
+/**
+ * Input: None
+ *
+ * Output: The peak resident memory of the process in kilobytes, or 0 where it
+ * cannot be measured.
+ *
+ * Purpose: To measure how much memory a run needs.
+ */
+inline size_t GetPeakMemoryKB() {
+#ifndef __EMSCRIPTEN__
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024; //bytes on macOS
+#else
+    return usage.ru_maxrss;
+#endif
+  }
+#endif
+  return 0;
+}
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+/**
+ * Reads the hardware performance counters of the current process (cycles,
+ * instructions, cache misses and branch misses) through Linux
+ * perf_event_open. User space only, so system calls made while timing are
+ * not counted.
+ *
+ * Counters are often unavailable: on other platforms, in containers, or when
+ * /proc/sys/kernel/perf_event_paranoid forbids them. Then IsAvailable() is
+ * false and every read is zero, so callers need no special cases. A counter
+ * the hardware does not support reads zero while the others still work.
+ */
+class PerfCounters {
+public:
+  static constexpr size_t NUM_COUNTERS = 4;
+  using counts_t = std::array<uint64_t, NUM_COUNTERS>;
+
+protected:
+  /**
+    *
+    * Purpose: Represents the file descriptor of each counter, or -1 if it
+    * could not be opened. The first counter leads the group, so all of them
+    * are read at once.
+    *
+  */
+  std::array<int, NUM_COUNTERS> fds = {-1, -1, -1, -1};
+
+  /**
+    *
+    * Purpose: Represents which counter each value of a group read belongs to,
+    * in the order the counters were opened.
+    *
+  */
+  emp::vector<size_t> opened;
+
+public:
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To open and start the counters, if the system allows it.
+   */
+  PerfCounters() {
+#ifdef __linux__
+    const uint64_t configs[NUM_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for (size_t i = 0; i < NUM_COUNTERS; i++) {
+      struct perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = configs[i];
+      attr.disabled = (i == 0);
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      int fd = syscall(__NR_perf_event_open, &attr, 0, -1, fds[0], 0);
+      if (i == 0 && fd < 0) return; //no cycle counter, so no group
+      fds[i] = fd;
+      if (fd >= 0) opened.push_back(i);
+    }
+    ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To close the counters.
+   */
+  ~PerfCounters() {
+#ifdef __linux__
+    for (int fd : fds) {
+      if (fd >= 0) close(fd);
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters & operator=(const PerfCounters &) = delete;
+
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the counters could be opened.
+   *
+   * Purpose: To determine whether reads will be meaningful.
+   */
+  bool IsAvailable() const { return fds[0] >= 0; }
+
+
+  /**
+   * Input: The index of a counter.
+   *
+   * Output: The name of the counter used in output files.
+   *
+   * Purpose: To label counters.
+   */
+  static std::string GetCounterName(size_t counter) {
+    const char * names[NUM_COUNTERS] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+    return names[counter];
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The current value of every counter, all zero if they are
+   * unavailable.
+   *
+   * Purpose: To take a reading at the start or end of a phase.
+   */
+  counts_t Read() const {
+    counts_t counts = {0, 0, 0, 0};
+#ifdef __linux__
+    if (!IsAvailable()) return counts;
+    uint64_t buffer[1 + NUM_COUNTERS];
+    if (read(fds[0], buffer, sizeof(buffer)) < (ssize_t) sizeof(uint64_t)) return counts;
+    for (size_t i = 0; i < buffer[0] && i < opened.size(); i++) {
+      counts[opened[i]] = buffer[1 + i];
+    }
+#endif
+    return counts;
+  }
+};
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef PHASE_PROFILER_H
+#define PHASE_PROFILER_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "PerfCounters.h"
+#include <chrono>
+#include <fstream>
+#include <string>
+
+/**
+ * Times the phases of SymWorld::Update and RunExperiment.
+ *
+ * The world only creates a profiler, and the SYM_PROFILE_SCOPE timers only
+ * exist, when compiled with -DSYMBULATION_PROFILE (see `make profile-default`),
+ * so normal builds pay nothing for it.
+ *
+ * Two files are written. The summary file has one row every summary_interval
+ * updates with the milliseconds spent in each phase over those updates. The
+ * trace file is a Chrome trace (open it at chrome://tracing or in Perfetto).
+ * Coarse phases appear as spans on the timeline. Phases timed once per cell
+ * would make the trace enormous, so those are summed over each update and
+ * shown as counters.
+ *
+ * Timings are inclusive: a birth during host processing counts toward both,
+ * and stats includes output, which happens inside the Empirical update.
+ *
+ * With EnableCounters, each phase also accumulates hardware performance
+ * counters over the whole run, written to a third file when the profiler is
+ * destroyed. Reading the counters is a system call, which slows the per-cell
+ * phases noticeably, but user space counts are not affected by it.
+ */
+class PhaseProfiler {
+public:
+  /**
+   * The phases that can be timed.
+   */
+  enum Phase {
+    UPDATE = 0,
+    HOST_PROCESS,
+    SYM_PROCESS,
+    BIRTH,
+    STATS,
+    OUTPUT,
+    SYSTEMATICS,
+    RUN,
+    NO_MUT_RUN,
+    NUM_PHASES
+  };
+
+  using clock_t = std::chrono::steady_clock;
+
+protected:
+  /**
+    *
+    * Purpose: Represents the file the per-interval summary is written to, and
+    * how many updates each summary row covers.
+    *
+  */
+  std::ofstream summary;
+  size_t summary_interval;
+
+  /**
+    *
+    * Purpose: Represents the Chrome trace file, and whether an event has been
+    * written to it yet (events after the first need a leading comma).
+    *
+  */
+  std::ofstream trace;
+  bool first_event = true;
+
+  /**
+    *
+    * Purpose: Represents the time the profiler was created, which is time
+    * zero of the trace.
+    *
+  */
+  clock_t::time_point start;
+
+  /**
+    *
+    * Purpose: Represents the nanoseconds spent in each phase during the
+    * current summary interval and during the current update.
+    *
+  */
+  emp::vector<double> interval_ns;
+  emp::vector<double> update_ns;
+
+  /**
+    *
+    * Purpose: Represents the number of updates finished so far.
+    *
+  */
+  size_t num_updates = 0;
+
+  /**
+    *
+    * Purpose: Represents the hardware counters, the counts accumulated by
+    * each phase over the run, and the file they are written to. The counters
+    * are null unless EnableCounters was called.
+    *
+  */
+  emp::Ptr<PerfCounters> counters = nullptr;
+  emp::vector<PerfCounters::counts_t> run_counts;
+  std::string counters_path;
+
+  /**
+   * Input: A time point.
+   *
+   * Output: The microseconds since the profiler was created.
+   *
+   * Purpose: To convert a time point to a trace timestamp.
+   */
+  double Micros(clock_t::time_point time) const {
+    return std::chrono::duration<double, std::micro>(time - start).count();
+  }
+
+  /**
+   * Input: The JSON object for one trace event.
+   *
+   * Output: None
+   *
+   * Purpose: To append an event to the trace.
+   */
+  void WriteEvent(const std::string & event) {
+    if (!first_event) trace << ",\n";
+    first_event = false;
+    trace << event;
+  }
+
+  /**
+   * Input: A phase.
+   *
+   * Output: The bool representing if the phase is timed once per cell.
+   *
+   * Purpose: To decide whether a phase is traced as a span or as a counter.
+   */
+  static bool IsPerCell(Phase phase) {
+    return phase == HOST_PROCESS || phase == SYM_PROCESS || phase == BIRTH;
+  }
+
+  /**
+   * Input: The time the update finished.
+   *
+   * Output: None
+   *
+   * Purpose: To write the per-update counters to the trace and, every
+   * summary_interval updates, a row to the summary file.
+   */
+  void FinishUpdate(clock_t::time_point end) {
+    std::string args;
+    for (size_t phase = 0; phase < NUM_PHASES; phase++) {
+      if (!IsPerCell((Phase) phase)) continue;
+      if (args.size()) args += ",";
+      args += "\"" + GetPhaseName((Phase) phase) + "\":" + std::to_string(update_ns[phase] / 1e6);
+      update_ns[phase] = 0;
+    }
+    WriteEvent("{\"name\":\"per-cell ms\",\"ph\":\"C\",\"pid\":0,\"tid\":0,\"ts\":" +
+               std::to_string(Micros(end)) + ",\"args\":{" + args + "}}");
+
+    if (num_updates % summary_interval == 0) {
+      summary << num_updates;
+      for (size_t phase = 0; phase < NUM_PHASES; phase++) {
+        summary << ',' << interval_ns[phase] / 1e6;
+        interval_ns[phase] = 0;
+      }
+      summary << '\n';
+      summary.flush();
+    }
+    num_updates++;
+  }
+
+public:
+  /**
+   * Input: The path of the summary file; the path of the trace file; the
+   * number of updates each summary row covers.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a PhaseProfiler and write the file headers.
+   */
+  PhaseProfiler(const std::string & summary_path, const std::string & trace_path, size_t _summary_interval)
+    : summary(summary_path), summary_interval(_summary_interval ? _summary_interval : 1), trace(trace_path),
+      start(clock_t::now()), interval_ns(NUM_PHASES, 0), update_ns(NUM_PHASES, 0),
+      run_counts(NUM_PHASES, PerfCounters::counts_t{0, 0, 0, 0}) {
+    summary << "update";
+    for (size_t phase = 0; phase < NUM_PHASES; phase++) summary << ',' << GetPhaseName((Phase) phase) << "_ms";
+    summary << '\n';
+    trace << "{\"traceEvents\":[\n";
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To close the trace so that it is valid JSON, and write the
+   * hardware counter totals.
+   */
+  ~PhaseProfiler() {
+    trace << "\n]}\n";
+    if (counters) {
+      WriteCounters(counters_path);
+      counters.Delete();
+    }
+  }
+
+  PhaseProfiler(const PhaseProfiler &) = delete;
+  PhaseProfiler & operator=(const PhaseProfiler &) = delete;
+
+
+  /**
+   * Input: A phase.
+   *
+   * Output: The name of the phase used in the output files.
+   *
+   * Purpose: To label phases.
+   */
+  static std::string GetPhaseName(Phase phase) {
+    switch (phase) {
+      case UPDATE: return "update";
+      case HOST_PROCESS: return "host_process";
+      case SYM_PROCESS: return "sym_process";
+      case BIRTH: return "birth";
+      case STATS: return "stats";
+      case OUTPUT: return "output";
+      case SYSTEMATICS: return "systematics";
+      case RUN: return "run";
+      case NO_MUT_RUN: return "no_mut_run";
+      default: return "unknown";
+    }
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The current time.
+   *
+   * Purpose: To start timing a phase.
+   */
+  clock_t::time_point Now() const { return clock_t::now(); }
+
+
+  /**
+   * Input: The phase; the time it began; the time it ended.
+   *
+   * Output: None
+   *
+   * Purpose: To record one timed run of a phase. Recording the end of an
+   * update also finishes that update's counters and summary.
+   */
+  void Record(Phase phase, clock_t::time_point begin, clock_t::time_point end) {
+    double ns = std::chrono::duration<double, std::nano>(end - begin).count();
+    interval_ns[phase] += ns;
+    if (IsPerCell(phase)) {
+      update_ns[phase] += ns;
+    } else {
+      WriteEvent("{\"name\":\"" + GetPhaseName(phase) + "\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" +
+                 std::to_string(Micros(begin)) + ",\"dur\":" + std::to_string(ns / 1e3) + "}");
+    }
+    if (phase == UPDATE) FinishUpdate(end);
+  }
+
+
+  /**
+   * Input: The path of the file to write the counter totals to.
+   *
+   * Output: The bool representing if hardware counters are available.
+   *
+   * Purpose: To also count cycles, instructions, cache misses and branch
+   * misses in every phase. If the counters are unavailable, nothing is
+   * counted and no file is written.
+   */
+  bool EnableCounters(const std::string & path) {
+    if (!counters) counters = emp::NewPtr<PerfCounters>();
+    counters_path = path;
+    if (counters->IsAvailable()) return true;
+    counters.Delete();
+    counters = nullptr;
+    return false;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The current counter values, all zero if counters are not enabled.
+   *
+   * Purpose: To take a reading at the start of a phase.
+   */
+  PerfCounters::counts_t ReadCounters() const {
+    if (!counters) return PerfCounters::counts_t{0, 0, 0, 0};
+    return counters->Read();
+  }
+
+
+  /**
+   * Input: The phase; the counter values when it began.
+   *
+   * Output: None
+   *
+   * Purpose: To add the counts of one run of a phase to its totals.
+   */
+  void RecordCounters(Phase phase, const PerfCounters::counts_t & begin) {
+    if (!counters) return;
+    PerfCounters::counts_t end = counters->Read();
+    for (size_t i = 0; i < PerfCounters::NUM_COUNTERS; i++) run_counts[phase][i] += end[i] - begin[i];
+  }
+
+
+  /**
+   * Input: A phase.
+   *
+   * Output: The counts accumulated by the phase over the run.
+   *
+   * Purpose: To retrieve the hardware counter totals of a phase.
+   */
+  const PerfCounters::counts_t & GetCounts(Phase phase) const { return run_counts[phase]; }
+
+
+  /**
+   * Input: The path of the file to write.
+   *
+   * Output: None
+   *
+   * Purpose: To write the counter totals of each phase, one row per phase,
+   * with instructions per cycle.
+   */
+  void WriteCounters(const std::string & path) const {
+    std::ofstream out(path);
+    out << "phase";
+    for (size_t i = 0; i < PerfCounters::NUM_COUNTERS; i++) out << ',' << PerfCounters::GetCounterName(i);
+    out << ",ipc\n";
+    for (size_t phase = 0; phase < NUM_PHASES; phase++) {
+      const PerfCounters::counts_t & counts = run_counts[phase];
+      out << GetPhaseName((Phase) phase);
+      for (uint64_t count : counts) out << ',' << count;
+      out << ',' << (counts[0] ? (double) counts[1] / counts[0] : 0.0) << '\n';
+    }
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of updates recorded.
+   *
+   * Purpose: To determine how many updates have been profiled.
+   */
+  size_t GetNumUpdates() const { return num_updates; }
+};
+
+
+/**
+ * Times a phase from its construction until the end of its scope.
+ */
+class ScopedPhaseTimer {
+protected:
+  emp::Ptr<PhaseProfiler> profiler;
+  PhaseProfiler::Phase phase;
+  PhaseProfiler::clock_t::time_point begin;
+  PerfCounters::counts_t begin_counts;
+
+public:
+  /**
+   * Input: The profiler to record to, which may be nullptr; the phase.
+   *
+   * Output: None
+   *
+   * Purpose: To start timing a phase.
+   */
+  ScopedPhaseTimer(emp::Ptr<PhaseProfiler> _profiler, PhaseProfiler::Phase _phase)
+    : profiler(_profiler), phase(_phase) {
+    if (profiler) {
+      begin = profiler->Now();
+      begin_counts = profiler->ReadCounters();
+    }
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To stop timing and record the phase.
+   */
+  ~ScopedPhaseTimer() {
+    if (profiler) {
+      profiler->RecordCounters(phase, begin_counts);
+      profiler->Record(phase, begin, profiler->Now());
+    }
+  }
+};
+
+
+#define SYM_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SYM_PROFILE_CONCAT(a, b) SYM_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef SYMBULATION_PROFILE
+#define SYM_PROFILE_SCOPE(profiler, phase) \
+  ScopedPhaseTimer SYM_PROFILE_CONCAT(sym_phase_timer_, __LINE__)(profiler, PhaseProfiler::phase)
+#else
+#define SYM_PROFILE_SCOPE(profiler, phase)
+#endif
+
+#endif
@@ -0,0 +1,291 @@
+#ifndef RECORD_STREAM_H
+#define RECORD_STREAM_H
+
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+/**
+ * Purpose: The first line of every record stream, used to recognize the format.
+ */
+const std::string RECORD_STREAM_MAGIC = "#symbulation-stream\t1";
+
+
+/**
+ * A single append-only file holding every data series of a run.
+ *
+ * The stream starts with RECORD_STREAM_MAGIC. Each series is declared once with
+ * a "#series<TAB>tag<TAB>name" line, where name is the file the series would
+ * otherwise have been written to. Every line of a series is then written as
+ * "tag<TAB>line". When the stream is finalized, an index footer lists each
+ * series as "#index<TAB>tag<TAB>name<TAB>records<TAB>bytes", followed by a
+ * closing "#end<TAB>offset" line giving the byte offset of the first index line.
+ */
+class RecordStream {
+protected:
+  /**
+    *
+    * Purpose: Represents the file every record is appended to.
+    *
+  */
+  std::ofstream out;
+
+  /**
+    *
+    * Purpose: Represents the names of the declared series, indexed by tag.
+    *
+  */
+  emp::vector<std::string> series_names;
+
+  /**
+    *
+    * Purpose: Represents the number of records written for each series.
+    *
+  */
+  emp::vector<size_t> series_records;
+
+  /**
+    *
+    * Purpose: Represents the number of payload bytes written for each series.
+    *
+  */
+  emp::vector<size_t> series_bytes;
+
+  /**
+    *
+    * Purpose: Represents the byte offset of the end of the stream so far.
+    *
+  */
+  size_t offset = 0;
+
+  /**
+    *
+    * Purpose: Represents whether the index footer has been written.
+    *
+  */
+  bool finalized = false;
+
+  /**
+   * Input: The string to append.
+   *
+   * Output: None
+   *
+   * Purpose: To append raw text to the stream and keep track of the offset.
+   */
+  void Append(const std::string & text) {
+    out.write(text.data(), text.size());
+    offset += text.size();
+  }
+
+public:
+  /**
+   * Input: The name of the file to write the stream to.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a RecordStream and write its magic line.
+   */
+  RecordStream(const std::string & filename) : out(filename) {
+    Append(RECORD_STREAM_MAGIC + "\n");
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To make sure the index footer is written even if Finalize was
+   * never called.
+   */
+  ~RecordStream() { Finalize(); }
+
+  RecordStream(const RecordStream &) = delete;
+  RecordStream & operator=(const RecordStream &) = delete;
+
+
+  /**
+   * Input: The name of the file the series would otherwise have been written to.
+   *
+   * Output: The size_t tag that identifies the series' records.
+   *
+   * Purpose: To declare a new series in the stream.
+   */
+  size_t AddSeries(const std::string & name) {
+    size_t tag = series_names.size();
+    series_names.push_back(name);
+    series_records.push_back(0);
+    series_bytes.push_back(0);
+    Append("#series\t" + std::to_string(tag) + "\t" + name + "\n");
+    return tag;
+  }
+
+
+  /**
+   * Input: The tag of the series; the line to record, with or without
+   * its trailing newline.
+   *
+   * Output: None
+   *
+   * Purpose: To append one line of a series to the stream.
+   */
+  void WriteRecord(size_t tag, const std::string & line) {
+    if (finalized) throw "Record written to a finalized RecordStream";
+    if (tag >= series_names.size()) throw "Record written to an undeclared series";
+    std::string record = std::to_string(tag);
+    record += '\t';
+    record += line;
+    if (line.empty() || line.back() != '\n') record += '\n';
+    series_records[tag]++;
+    series_bytes[tag] += record.size();
+    Append(record);
+    out.flush();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the index footer and close the stream. Later calls do
+   * nothing.
+   */
+  void Finalize() {
+    if (finalized) return;
+    finalized = true;
+    size_t index_offset = offset;
+    for (size_t tag = 0; tag < series_names.size(); tag++) {
+      Append("#index\t" + std::to_string(tag) + "\t" + series_names[tag] + "\t" +
+             std::to_string(series_records[tag]) + "\t" + std::to_string(series_bytes[tag]) + "\n");
+    }
+    Append("#end\t" + std::to_string(index_offset) + "\n");
+    out.close();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The size_t number of declared series.
+   *
+   * Purpose: To determine how many series are in the stream.
+   */
+  size_t GetNumSeries() const { return series_names.size(); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the index footer has been written.
+   *
+   * Purpose: To determine if the stream has been finalized.
+   */
+  bool IsFinalized() const { return finalized; }
+};
+
+
+/**
+ * A stream buffer that writes each complete line it receives as a record of
+ * one series of a RecordStream, so that anything printed to an ostream, such
+ * as the output of emp::DataFile, ends up in the stream. A trailing partial
+ * line is held until its newline arrives.
+ */
+class RecordLineBuf : public std::streambuf {
+protected:
+  /**
+    *
+    * Purpose: Represents the stream and the tag of the series to write to.
+    *
+  */
+  RecordStream & record_stream;
+  size_t tag;
+
+  /**
+    *
+    * Purpose: Represents the line received so far.
+    *
+  */
+  std::string pending;
+
+  int overflow(int c) override {
+    if (c == traits_type::eof()) return traits_type::not_eof(c);
+    pending += (char) c;
+    if (c == '\n') {
+      record_stream.WriteRecord(tag, pending);
+      pending.clear();
+    }
+    return c;
+  }
+
+  std::streamsize xsputn(const char * s, std::streamsize n) override {
+    for (std::streamsize i = 0; i < n; i++) overflow((unsigned char) s[i]);
+    return n;
+  }
+
+public:
+  /**
+   * Input: The record stream to write to; the tag of the series.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a buffer that writes lines to one series.
+   */
+  RecordLineBuf(RecordStream & _stream, size_t _tag) : record_stream(_stream), tag(_tag) {}
+};
+
+
+/**
+ * Input: The stream holding a record stream; the map to fill with the lines of
+ * each series, keyed by series name.
+ *
+ * Output: The bool representing if the stream was complete, meaning it ended
+ * with an index footer whose record counts match the records read.
+ *
+ * Purpose: To split a record stream back into its series.
+ */
+bool ReadRecordStream(std::istream & in, std::map<std::string, std::stringstream> & series) {
+  std::string line;
+  if (!std::getline(in, line) || line != RECORD_STREAM_MAGIC) throw "Not a symbulation record stream";
+
+  emp::vector<std::string> names;
+  emp::vector<size_t> counts;
+  bool complete = false;
+  bool counts_match = true;
+  while (std::getline(in, line)) {
+    size_t tab = line.find('\t');
+    if (tab == std::string::npos) throw "Malformed record stream line";
+    std::string head = line.substr(0, tab);
+    std::string rest = line.substr(tab + 1);
+
+    if (head == "#series") {
+      size_t tag_end = rest.find('\t');
+      size_t tag = std::stoul(rest.substr(0, tag_end));
+      if (tag != names.size()) throw "Record stream series declared out of order";
+      names.push_back(rest.substr(tag_end + 1));
+      counts.push_back(0);
+      series[names.back()];
+    } else if (head == "#index") {
+      std::stringstream fields(rest);
+      std::string tag, name, records;
+      std::getline(fields, tag, '\t');
+      std::getline(fields, name, '\t');
+      std::getline(fields, records, '\t');
+      size_t id = std::stoul(tag);
+      if (id >= counts.size() || counts[id] != std::stoul(records)) counts_match = false;
+    } else if (head == "#end") {
+      complete = true;
+    } else {
+      size_t tag = std::stoul(head);
+      if (tag >= names.size()) throw "Record for an undeclared series";
+      series[names[tag]] << rest << '\n';
+      counts[tag]++;
+    }
+  }
+  return complete && counts_match;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef RESOURCE_KERNEL_H
+#define RESOURCE_KERNEL_H
+
+#include <cstddef>
+
+/**
+ * The arithmetic of distributing resources between a host and one of its
+ * symbionts, which Host::DistribResToSym, Host::StealResources and
+ * Symbiont::ProcessResources carry out through virtual calls and the host's
+ * res_in_process.
+ *
+ * Each pair only needs the two interaction values, the resources given to
+ * the pair and SYNERGY, so it is computed here with selects instead of
+ * branches. The operations are the same, in the same order, as in the scalar
+ * path, so the results are identical.
+ *
+ * Host::DistribResources calls DistribPair for each symbiont that uses
+ * Symbiont::ProcessResources, in place of the calls to ProcessResources and
+ * StealResources. Each pair still makes virtual calls to check the
+ * symbiont, get its payoff and add the points. The update never runs the
+ * kernel over arrays of pairs, because hosts are processed one at a time and
+ * hold their symbionts as organisms; the microbench times such a batch.
+ */
+struct ResourceKernel {
+  /**
+   * Input: The interaction values of the host and symbiont; the resources
+   * given to the pair; the SYNERGY multiplier; where to put the points the
+   * host and the symbiont gain.
+   *
+   * Output: None
+   *
+   * Purpose: To compute the points a host and one of its symbionts gain from
+   * the symbiont's piece of the host's resources.
+   */
+  static inline void DistribPair(double host_int_val, double sym_int_val, double sym_piece, double synergy,
+                                 double & host_gain, double & sym_gain) {
+    //the host donates to its symbiont or spends on defense (Host::DistribResToSym)
+    double host_share = host_int_val * sym_piece;
+    bool host_defends = host_int_val < 0;
+    double donation = host_defends ? 0.0 : host_share;
+    double res_in_process = sym_piece - (host_defends ? host_share * -1.0 : host_share);
+
+    //a symbiont more antagonistic than the host's defense steals (Host::StealResources);
+    //cooperative hosts defend as if they were neutral
+    double host_guard = host_int_val > 0 ? 0.0 : host_int_val;
+    double stolen = sym_int_val < host_guard ? (host_guard - sym_int_val) * res_in_process : 0.0;
+    res_in_process = res_in_process - stolen;
+
+    //the symbiont keeps what it stole or returns part of the donation (Symbiont::ProcessResources)
+    bool sym_steals = sym_int_val < 0;
+    double host_portion = sym_steals ? 0.0 : donation * sym_int_val;
+    sym_gain = sym_steals ? stolen + donation : donation - host_portion;
+    host_gain = host_portion * synergy + res_in_process;
+  }
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef STATE_HASHER_H
+#define STATE_HASHER_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/**
+ * Builds a 64-bit digest of a sequence of values. The digest depends on the
+ * order values are added in, so two states digest equally only if the same
+ * values were added in the same order.
+ *
+ * Doubles are hashed by their bits, so any difference in the last place is
+ * caught, except that -0.0 and 0.0 are treated as equal.
+ */
+class StateHasher {
+protected:
+  /**
+    *
+    * Purpose: Represents the digest of the values added so far.
+    *
+  */
+  uint64_t digest = 0x9e3779b97f4a7c15;
+
+  /**
+   * Input: A 64-bit word.
+   *
+   * Output: The word with its bits thoroughly mixed.
+   *
+   * Purpose: To spread every input bit over the whole digest (the splitmix64
+   * finalizer).
+   */
+  static uint64_t Mix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111eb;
+    x ^= x >> 31;
+    return x;
+  }
+
+public:
+  /**
+   * Input: A 64-bit word.
+   *
+   * Output: None
+   *
+   * Purpose: To add a raw word to the digest.
+   */
+  void AddWord(uint64_t word) {
+    digest = Mix(digest ^ Mix(word + 0x632be59bd9b4e019));
+  }
+
+
+  /**
+   * Input: A number or bool.
+   *
+   * Output: None
+   *
+   * Purpose: To add a value to the digest.
+   */
+  template <typename T>
+  void Add(T val) {
+    static_assert(std::is_arithmetic<T>::value, "StateHasher can only add numbers");
+    if constexpr (std::is_floating_point<T>::value) {
+      double as_double = val;
+      if (as_double == 0) as_double = 0; //fold -0.0 into 0.0
+      uint64_t bits;
+      std::memcpy(&bits, &as_double, sizeof(bits));
+      AddWord(bits);
+    } else {
+      AddWord((uint64_t) val);
+    }
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The digest of the values added so far.
+   *
+   * Purpose: To retrieve the digest.
+   */
+  uint64_t GetDigest() const { return digest; }
+
+
+  /**
+   * Input: A digest.
+   *
+   * Output: The digest as 16 hexadecimal digits.
+   *
+   * Purpose: To print digests in a fixed width form.
+   */
+  static std::string ToHex(uint64_t val) {
+    const char * digits = "0123456789abcdef";
+    std::string out(16, '0');
+    for (size_t i = 0; i < 16; i++) {
+      out[15 - i] = digits[val & 0xf];
+      val >>= 4;
+    }
+    return out;
+  }
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef SYM_CONTEXT_H
+#define SYM_CONTEXT_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/math/Random.hpp"
+#include "../ConfigSetup.h"
+
+class SymWorld;
+
+/**
+ * The random number generator, world and configuration that an organism
+ * uses. Each world owns the context of its random number generator and
+ * configuration, and organisms built for the world hold a pointer to it
+ * instead of their own copy of all three, so organisms must not outlive
+ * their world.
+ */
+struct SymContext {
+  emp::Ptr<emp::Random> random;
+  emp::Ptr<SymWorld> world;
+  emp::Ptr<SymConfigBase> config;
+
+  /**
+   * Input: The random number generator, world and configuration.
+   *
+   * Output: The bool representing if this context holds them.
+   *
+   * Purpose: To look up contexts.
+   */
+  bool Matches(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config) const {
+    return random == _random && world == _world && config == _config;
+  }
+};
+
+#endif
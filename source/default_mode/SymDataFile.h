@@ -0,0 +1,522 @@
+#ifndef SYM_DATA_FILE_H
+#define SYM_DATA_FILE_H
+
+#include "../../Empirical/include/emp/data/DataFile.hpp"
+#include "../../Empirical/include/emp/data/DataNode.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "RecordStream.h"
+#include "PhaseProfiler.h"
+#include <charconv>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+/**
+ * Purpose: The suffix appended to the name of any data file that is written
+ * with delta encoding, so that it is never mistaken for a plain csv.
+ */
+const std::string DELTA_FILE_SUFFIX = ".delta";
+
+
+/**
+ * Input: The string to append to; the number to append.
+ *
+ * Output: None
+ *
+ * Purpose: To format a number without going through iostreams. Integers are
+ * written exactly, and floating point values use the same six significant
+ * digit general format as a default std::ostream, so the text is identical
+ * to what emp::DataFile would have printed.
+ */
+template <typename T>
+void AppendNumber(std::string & out, T val) {
+  char buffer[32];
+  std::to_chars_result result;
+  if constexpr (std::is_floating_point<T>::value) {
+    result = std::to_chars(buffer, buffer + sizeof(buffer), val, std::chars_format::general, 6);
+  } else if constexpr (std::is_same<T, bool>::value) {
+    result = std::to_chars(buffer, buffer + sizeof(buffer), (int) val);
+  } else {
+    result = std::to_chars(buffer, buffer + sizeof(buffer), val);
+  }
+  out.append(buffer, result.ptr);
+}
+
+
+class SymDataFile : public emp::DataFile {
+protected:
+  using cell_fun_t = std::function<void(std::string &)>;
+
+  /**
+    *
+    * Purpose: Represents the functions that append each numeric column
+    * straight to the row buffer. Parallel to funs; an empty entry means that
+    * column was added through emp::DataFile and is printed with its stream
+    * function instead.
+    *
+  */
+  emp::vector<cell_fun_t> cell_funs;
+
+  /**
+    *
+    * Purpose: Represents the buffer each row is assembled in before being
+    * written out with a single call. Reused between rows.
+    *
+  */
+  std::string row_buffer;
+
+  /**
+    *
+    * Purpose: Represents whether rows should only record the cells that
+    * changed since the previous row. Set with SetDeltaEncoding().
+    *
+  */
+  bool delta_encode = false;
+
+  /**
+    *
+    * Purpose: Represents the cells of the last row written, used as the
+    * reference for delta encoding the next row.
+    *
+  */
+  emp::vector<std::string> prev_row;
+
+  /**
+    *
+    * Purpose: Represents the cells of the row currently being written.
+    *
+  */
+  emp::vector<std::string> cur_row;
+
+  /**
+    *
+    * Purpose: Represents the scratch stream each column is printed into
+    * before being compared against the previous row.
+    *
+  */
+  std::stringstream cell_stream;
+
+  /**
+    *
+    * Purpose: Represents the record stream this file's lines are written to
+    * instead of its own file. Null when the file writes to a stream of its own.
+    *
+  */
+  emp::Ptr<RecordStream> record_stream = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the stream given to emp::DataFile when the file is
+    * part of a record stream, so that lines printed by emp::DataFile methods
+    * are also written as records of its series.
+    *
+  */
+  emp::Ptr<RecordLineBuf> record_buf = nullptr;
+  emp::Ptr<std::ostream> record_os = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the tag of this file's series in the record stream.
+    *
+  */
+  size_t stream_tag = 0;
+
+  /**
+    *
+    * Purpose: Represents the profiler that times writing rows. Only set in
+    * builds compiled with SYMBULATION_PROFILE.
+    *
+  */
+  emp::Ptr<PhaseProfiler> profiler = nullptr;
+
+  /**
+   * Input: None
+   *
+   * Output: The address of an ostream that discards everything written to it.
+   *
+   * Purpose: To give emp::DataFile a stream to hold until the stream that
+   * forwards to the record stream has been built, and after it is deleted.
+   */
+  static std::ostream & GetNullStream() {
+    static std::ostream null_stream(nullptr);
+    return null_stream;
+  }
+
+  /**
+   * Input: The complete line to write, including its line ending.
+   *
+   * Output: None
+   *
+   * Purpose: To write a line either to this file's own stream or, if the
+   * file is part of a record stream, as a record of its series.
+   */
+  void WriteLine(const std::string & line) {
+    if (record_stream) {
+      record_stream->WriteRecord(stream_tag, line);
+    } else {
+      os->write(line.data(), line.size());
+      os->flush();
+    }
+  }
+
+public:
+  /**
+   * Input: The name of the file to write to; optionally the strings that
+   * begin a line, separate cells, and end a line.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a SymDataFile that writes to the named file.
+   */
+  SymDataFile(const std::string & in_filename, const std::string & b="",
+              const std::string & s=",", const std::string & e="\n")
+    : emp::DataFile(in_filename, b, s, e) {}
+
+
+  /**
+   * Input: The stream to write to; optionally the strings that begin a
+   * line, separate cells, and end a line.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a SymDataFile that writes to an existing stream.
+   */
+  SymDataFile(std::ostream & in_os, const std::string & b="",
+              const std::string & s=",", const std::string & e="\n")
+    : emp::DataFile(in_os, b, s, e) {}
+
+
+  /**
+   * Input: The record stream to write to; the name of the file this series
+   * would otherwise have been written to.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a SymDataFile whose lines are records of a new
+   * series in a shared record stream. The stream must outlive the file's
+   * last Update, but is never touched when the file is destroyed. Lines
+   * printed by emp::DataFile methods, such as PrintHeaderComment, are
+   * written to the series too.
+   */
+  SymDataFile(emp::Ptr<RecordStream> _stream, const std::string & series_name)
+    : emp::DataFile(GetNullStream()), record_stream(_stream) {
+    filename = series_name;
+    stream_tag = record_stream->AddSeries(series_name);
+    record_buf = emp::NewPtr<RecordLineBuf>(*record_stream, stream_tag);
+    record_os = emp::NewPtr<std::ostream>(record_buf.Raw());
+    os = record_os.Raw();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To delete the stream forwarding to the record stream, leaving
+   * emp::DataFile a stream to flush as it is destroyed.
+   */
+  ~SymDataFile() {
+    if (record_os) {
+      os = &GetNullStream();
+      record_os.Delete();
+      record_buf.Delete();
+    }
+  }
+
+  SymDataFile(const SymDataFile &) = delete;
+  SymDataFile & operator=(const SymDataFile &) = delete;
+
+
+  /**
+   * Input: The bool representing whether rows should be delta encoded.
+   *
+   * Output: None
+   *
+   * Purpose: To turn delta encoding on or off. The next row written is
+   * always written in full.
+   */
+  void SetDeltaEncoding(bool _in) {
+    delta_encode = _in;
+    prev_row.clear();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing whether rows are delta encoded.
+   *
+   * Purpose: To determine if this file is delta encoded.
+   */
+  bool GetDeltaEncoding() const { return delta_encode; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing whether this file writes to a record stream.
+   *
+   * Purpose: To determine if this file is a series of a record stream.
+   */
+  bool IsStreamed() const { return (bool) record_stream; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To hide the emp::DataFile version so that the header line is
+   * routed the same way as the rows.
+   */
+  void PrintHeaderKeys() {
+    row_buffer.clear();
+    row_buffer += line_begin;
+    for (size_t i = 0; i < keys.size(); i++) {
+      if (i > 0) row_buffer += line_spacer;
+      row_buffer += keys[i];
+    }
+    row_buffer += line_end;
+    WriteLine(row_buffer);
+  }
+
+
+  /**
+   * Input: The function that appends a column's value to a string; the key
+   * and description of the column.
+   *
+   * Output: The size_t index of the new column.
+   *
+   * Purpose: To add a column that is formatted without iostreams.
+   */
+  size_t AddCell(const cell_fun_t & cell_fun, const std::string & key, const std::string & desc) {
+    cell_funs.resize(funs.size());
+    size_t id = Add([cell_fun](std::ostream & os){
+      std::string cell;
+      cell_fun(cell);
+      os << cell;
+    }, key, desc);
+    cell_funs.push_back(cell_fun);
+    return id;
+  }
+
+
+  /**
+   * Input: The variable to print; the key and description of the column.
+   *
+   * Output: The size_t index of the new column.
+   *
+   * Purpose: To print the current value of a variable each row. Numeric
+   * variables take the fast formatting path; chars and everything else are
+   * printed by emp::DataFile.
+   */
+  template <typename T>
+  size_t AddVar(const T & var, const std::string & key="", const std::string & desc="") {
+    if constexpr (std::is_arithmetic<T>::value && !std::is_same<T, char>::value) {
+      return AddCell([&var](std::string & out){ AppendNumber(out, var); }, key, desc);
+    } else {
+      return emp::DataFile::AddVar(var, key, desc);
+    }
+  }
+
+
+  /**
+   * Input: The data node to print from; the key and description of the column;
+   * whether the node should be reset or pulled each time it is printed.
+   *
+   * Output: The size_t index of the new column.
+   *
+   * Purpose: To print the mean of a data node each row.
+   */
+  template <typename VAL_TYPE, emp::data... MODS>
+  size_t AddMean(emp::DataNode<VAL_TYPE, MODS...> & node, const std::string & key="",
+                 const std::string & desc="", const bool & reset=false, const bool & pull=false) {
+    return AddCell([&node, reset, pull](std::string & out){
+      if (pull) node.PullData();
+      AppendNumber(out, node.GetMean());
+      if (reset) node.Reset();
+    }, key, desc);
+  }
+
+
+  /**
+   * Input: The data node to print from; the key and description of the column;
+   * whether the node should be reset or pulled each time it is printed.
+   *
+   * Output: The size_t index of the new column.
+   *
+   * Purpose: To print the total of a data node each row.
+   */
+  template <typename VAL_TYPE, emp::data... MODS>
+  size_t AddTotal(emp::DataNode<VAL_TYPE, MODS...> & node, const std::string & key="",
+                  const std::string & desc="", const bool & reset=false, const bool & pull=false) {
+    return AddCell([&node, reset, pull](std::string & out){
+      if (pull) node.PullData();
+      AppendNumber(out, node.GetTotal());
+      if (reset) node.Reset();
+    }, key, desc);
+  }
+
+
+  /**
+   * Input: The data node to print from; the index of the histogram bin; the key
+   * and description of the column; whether the node should be reset or pulled
+   * each time it is printed.
+   *
+   * Output: The size_t index of the new column.
+   *
+   * Purpose: To print the count of one histogram bin of a data node each row.
+   */
+  template <typename VAL_TYPE, emp::data... MODS>
+  size_t AddHistBin(emp::DataNode<VAL_TYPE, MODS...> & node, size_t bin_id, const std::string & key="",
+                    const std::string & desc="", const bool & reset=false, const bool & pull=false) {
+    return AddCell([&node, bin_id, reset, pull](std::string & out){
+      if (pull) node.PullData();
+      AppendNumber(out, node.GetHistCount(bin_id));
+      if (reset) node.Reset();
+    }, key, desc);
+  }
+
+
+  /**
+   * Input: The index of the column; the string to append its value to.
+   *
+   * Output: None
+   *
+   * Purpose: To format a single cell of the current row.
+   */
+  void WriteCell(size_t id, std::string & out) {
+    if (id < cell_funs.size() && cell_funs[id]) {
+      cell_funs[id](out);
+    } else {
+      cell_stream.str("");
+      cell_stream.clear();
+      funs[id](cell_stream);
+      out += cell_stream.str();
+    }
+  }
+
+
+  /**
+   * Input: The profiler to record to.
+   *
+   * Output: None
+   *
+   * Purpose: To time writing rows as the output phase of the profiler.
+   */
+  void SetProfiler(emp::Ptr<PhaseProfiler> _in) { profiler = _in; }
+
+
+  using emp::DataFile::Update;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To write the current row. The row is assembled in a reused buffer
+   * and written with a single call. When delta encoding is on, any run of
+   * cells equal to the cells above them is replaced by a single "~N" token,
+   * where N is the length of the run. The first row is always written in full,
+   * and the update column always changes, so rows are never empty.
+   */
+  void Update() override {
+    SYM_PROFILE_SCOPE(profiler, OUTPUT);
+    pre_funs.Run();
+    row_buffer.clear();
+    row_buffer += line_begin;
+
+    if (!delta_encode) {
+      for (size_t i = 0; i < funs.size(); i++) {
+        if (i > 0) row_buffer += line_spacer;
+        WriteCell(i, row_buffer);
+      }
+    } else {
+      cur_row.resize(funs.size());
+      for (size_t i = 0; i < funs.size(); i++) {
+        cur_row[i].clear();
+        WriteCell(i, cur_row[i]);
+      }
+
+      bool full_row = prev_row.size() != cur_row.size();
+      size_t run = 0;
+      bool first_cell = true;
+      for (size_t i = 0; i < cur_row.size(); i++) {
+        if (!full_row && cur_row[i] == prev_row[i]) {
+          run++;
+          continue;
+        }
+        if (run > 0) {
+          if (!first_cell) row_buffer += line_spacer;
+          row_buffer += '~';
+          AppendNumber(row_buffer, run);
+          first_cell = false;
+          run = 0;
+        }
+        if (!first_cell) row_buffer += line_spacer;
+        row_buffer += cur_row[i];
+        first_cell = false;
+      }
+      if (run > 0) {
+        if (!first_cell) row_buffer += line_spacer;
+        row_buffer += '~';
+        AppendNumber(row_buffer, run);
+      }
+      std::swap(prev_row, cur_row);
+    }
+
+    row_buffer += line_end;
+    WriteLine(row_buffer);
+  }
+};
+
+
+/**
+ * Input: The stream holding a delta encoded data file; the stream to write
+ * the decoded file to; optionally the cell separator used by the file.
+ *
+ * Output: The number of data rows decoded.
+ *
+ * Purpose: To reproduce the exact csv a SymDataFile would have written
+ * without delta encoding. Files that are not delta encoded are copied
+ * through unchanged.
+ */
+size_t DecodeDeltaData(std::istream & in, std::ostream & out, char spacer=',') {
+  std::string line;
+  if (!std::getline(in, line)) return 0;
+  out << line << '\n'; //header keys are never encoded
+
+  size_t num_rows = 0;
+  emp::vector<std::string> prev_row;
+  emp::vector<std::string> cur_row;
+  std::string cell;
+  while (std::getline(in, line)) {
+    cur_row.clear();
+    size_t col = 0;
+    std::stringstream line_stream(line);
+    while (std::getline(line_stream, cell, spacer)) {
+      if (!cell.empty() && cell[0] == '~') {
+        size_t run = std::stoul(cell.substr(1));
+        if (col + run > prev_row.size()) throw "Malformed delta encoded data file";
+        for (size_t i = 0; i < run; i++) cur_row.push_back(prev_row[col++]);
+      } else {
+        cur_row.push_back(cell);
+        col++;
+      }
+    }
+
+    for (size_t i = 0; i < cur_row.size(); i++) {
+      if (i > 0) out << spacer;
+      out << cur_row[i];
+    }
+    out << '\n';
+    std::swap(prev_row, cur_row);
+    num_rows++;
+  }
+  return num_rows;
+}
+
+#endif
@@ -0,0 +1,413 @@
+#ifndef SYM_LIST_H
+#define SYM_LIST_H
+
+#include "../../Empirical/include/emp/base/Ptr.hpp"
+#include "../../Empirical/include/emp/base/vector.hpp"
+#include "../../Empirical/include/emp/base/assert.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+class Organism;
+
+/**
+ * The overflow blocks of SymLists that are not in use, by the log2 of their
+ * size. A world owns one pool for the lists of its hosts, so hosts that gain
+ * and lose symbionts reuse blocks instead of allocating, and the blocks are
+ * freed with the world.
+ */
+class SymListPool {
+protected:
+  /**
+    *
+    * Purpose: Represents the free blocks of each size class.
+    *
+  */
+  emp::vector<emp::vector<emp::Ptr<Organism> *>> free_blocks;
+
+  /**
+   * Input: The number of slots, a power of two.
+   *
+   * Output: The log2 of the number of slots.
+   *
+   * Purpose: To find the pool entry for a block size.
+   */
+  static size_t SizeClass(uint32_t slots) {
+    size_t size_class = 0;
+    while ((1u << size_class) < slots) size_class++;
+    return size_class;
+  }
+
+public:
+  SymListPool() = default;
+  SymListPool(const SymListPool &) = delete;
+  SymListPool & operator=(const SymListPool &) = delete;
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To free the blocks held by the pool.
+   */
+  ~SymListPool() {
+    for (auto & blocks : free_blocks) {
+      for (emp::Ptr<Organism> * block : blocks) delete[] block;
+    }
+  }
+
+  /**
+   * Input: The number of slots, a power of two.
+   *
+   * Output: A block with that many slots.
+   *
+   * Purpose: To take a block from the pool, or allocate one if none is free.
+   */
+  emp::Ptr<Organism> * Acquire(uint32_t slots) {
+    size_t size_class = SizeClass(slots);
+    if (size_class < free_blocks.size() && free_blocks[size_class].size()) {
+      emp::Ptr<Organism> * block = free_blocks[size_class].back();
+      free_blocks[size_class].pop_back();
+      return block;
+    }
+    return new emp::Ptr<Organism>[slots];
+  }
+
+  /**
+   * Input: A block and its number of slots.
+   *
+   * Output: None
+   *
+   * Purpose: To return a block to the pool.
+   */
+  void Release(emp::Ptr<Organism> * block, uint32_t slots) {
+    size_t size_class = SizeClass(slots);
+    if (free_blocks.size() <= size_class) free_blocks.resize(size_class + 1);
+    free_blocks[size_class].push_back(block);
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The number of free blocks.
+   *
+   * Purpose: To determine how many blocks are waiting to be reused.
+   */
+  size_t GetNumFree() const {
+    size_t count = 0;
+    for (const auto & blocks : free_blocks) count += blocks.size();
+    return count;
+  }
+};
+
+/**
+ * The list of symbionts a host holds, used for both its symbionts and its
+ * reproductive symbionts.
+ *
+ * Most runs allow a single symbiont per host, so one symbiont is stored
+ * inline in the list itself and an empty or single-symbiont host needs no
+ * heap memory. Longer lists overflow into blocks of a power of two slots.
+ * The calls that grow or empty a list can be given a SymListPool to take
+ * blocks from and return them to; without one, blocks are allocated and
+ * freed directly. A list does not remember its pool, so any block can be
+ * freed by any list.
+ *
+ * It behaves like an emp::vector of symbiont pointers (indexing, iteration,
+ * push_back, erase, comparison and conversion to a vector) and adds
+ * SwapRemove, which removes a symbiont in constant time by moving the last
+ * symbiont into its place. Hosts erase dead symbionts in order unless
+ * SYM_SWAP_REMOVE is on, since swapping changes the order symbionts are
+ * processed in and so the order of random draws.
+ */
+class SymList {
+public:
+  using value_type = emp::Ptr<Organism>;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  static constexpr uint32_t INLINE_SLOTS = 1;
+
+protected:
+  /**
+    *
+    * Purpose: Represents the slots the symbionts are stored in: the inline
+    * slot, or an overflow block once there are more symbionts than fit
+    * inline.
+    *
+  */
+  value_type * items;
+  value_type inline_items[INLINE_SLOTS];
+
+  /**
+    *
+    * Purpose: Represents the number of symbionts and the number of slots.
+    *
+  */
+  uint32_t num_items = 0;
+  uint32_t num_slots = INLINE_SLOTS;
+
+  /**
+   * Input: The number of slots, a power of two; the pool, if any.
+   *
+   * Output: A block with that many slots.
+   *
+   * Purpose: To take a block from the pool, or allocate one.
+   */
+  static value_type * AcquireBlock(uint32_t slots, emp::Ptr<SymListPool> pool) {
+    if (pool) return pool->Acquire(slots);
+    return new value_type[slots];
+  }
+
+  /**
+   * Input: A block and its number of slots; the pool, if any.
+   *
+   * Output: None
+   *
+   * Purpose: To return a block to the pool, or free it.
+   */
+  static void ReleaseBlock(value_type * block, uint32_t slots, emp::Ptr<SymListPool> pool) {
+    if (pool) pool->Release(block, slots);
+    else delete[] block;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the symbionts are in an overflow block.
+   *
+   * Purpose: To determine where the symbionts are stored.
+   */
+  bool IsOverflowed() const { return items != inline_items; }
+
+  /**
+   * Input: The pool, if any.
+   *
+   * Output: None
+   *
+   * Purpose: To return any overflow block and go back to the inline slot.
+   */
+  void ReleaseStorage(emp::Ptr<SymListPool> pool = nullptr) {
+    if (IsOverflowed()) ReleaseBlock(items, num_slots, pool);
+    items = inline_items;
+    num_slots = INLINE_SLOTS;
+  }
+
+public:
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To construct an empty SymList.
+   */
+  SymList() : items(inline_items) {}
+
+  /**
+   * Input: The symbionts to hold.
+   *
+   * Output: None
+   *
+   * Purpose: To construct a SymList holding the symbionts of a vector.
+   */
+  SymList(const std::vector<value_type> & in) : items(inline_items) {
+    for (const value_type & sym : in) push_back(sym);
+  }
+
+  SymList(const SymList & in) : items(inline_items) {
+    for (const value_type & sym : in) push_back(sym);
+  }
+
+  SymList(SymList && in) : items(inline_items) { *this = std::move(in); }
+
+  SymList & operator=(const SymList & in) {
+    if (this != &in) {
+      clear();
+      for (const value_type & sym : in) push_back(sym);
+    }
+    return *this;
+  }
+
+  SymList & operator=(SymList && in) {
+    if (this == &in) return *this;
+    ReleaseStorage();
+    if (in.IsOverflowed()) {
+      items = in.items;
+      num_slots = in.num_slots;
+    } else {
+      for (uint32_t i = 0; i < in.num_items; i++) inline_items[i] = in.inline_items[i];
+    }
+    num_items = in.num_items;
+    in.items = in.inline_items;
+    in.num_items = 0;
+    in.num_slots = INLINE_SLOTS;
+    return *this;
+  }
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To free any overflow block. Symbionts are owned by the host,
+   * which deletes them.
+   */
+  ~SymList() { ReleaseStorage(); }
+
+  size_t size() const { return num_items; }
+  bool empty() const { return num_items == 0; }
+  size_t capacity() const { return num_slots; }
+
+  iterator begin() { return items; }
+  iterator end() { return items + num_items; }
+  const_iterator begin() const { return items; }
+  const_iterator end() const { return items + num_items; }
+  value_type * data() { return items; }
+
+  value_type & operator[](size_t pos) {
+    emp_assert(pos < num_items, pos, num_items);
+    return items[pos];
+  }
+  const value_type & operator[](size_t pos) const {
+    emp_assert(pos < num_items, pos, num_items);
+    return items[pos];
+  }
+  value_type & at(size_t pos) {
+    if (pos >= num_items) throw std::out_of_range("SymList index out of range");
+    return items[pos];
+  }
+  value_type & front() { return (*this)[0]; }
+  value_type & back() { return (*this)[num_items - 1]; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The number of heap bytes held by the list.
+   *
+   * Purpose: To measure memory, which is zero while the symbionts fit inline.
+   */
+  size_t GetHeapBytes() const { return IsOverflowed() ? num_slots * sizeof(value_type) : 0; }
+
+
+  /**
+   * Input: The symbiont to add; the pool to take blocks from, if any.
+   *
+   * Output: None
+   *
+   * Purpose: To add a symbiont to the end of the list, moving the list to a
+   * block twice as large when it is full.
+   */
+  void push_back(const value_type & sym, emp::Ptr<SymListPool> pool = nullptr) {
+    if (num_items == num_slots) {
+      uint32_t new_slots = num_slots * 2;
+      value_type * block = AcquireBlock(new_slots, pool);
+      for (uint32_t i = 0; i < num_items; i++) block[i] = items[i];
+      if (IsOverflowed()) ReleaseBlock(items, num_slots, pool);
+      items = block;
+      num_slots = new_slots;
+    }
+    items[num_items++] = sym;
+  }
+
+  void pop_back() {
+    emp_assert(num_items > 0);
+    items[--num_items] = nullptr;
+  }
+
+
+  /**
+   * Input: The position of the symbiont to remove.
+   *
+   * Output: None
+   *
+   * Purpose: To remove a symbiont in constant time. The last symbiont moves
+   * into its place, so a loop removing while iterating should visit the same
+   * position again rather than advance.
+   */
+  void SwapRemove(size_t pos) {
+    emp_assert(pos < num_items, pos, num_items);
+    items[pos] = items[num_items - 1];
+    pop_back();
+  }
+
+
+  /**
+   * Input: The position of the symbiont to remove.
+   *
+   * Output: An iterator to the symbiont that followed it.
+   *
+   * Purpose: To remove a symbiont while keeping the others in order.
+   */
+  iterator erase(iterator pos) {
+    for (iterator it = pos; it + 1 < end(); it++) *it = *(it + 1);
+    pop_back();
+    return pos;
+  }
+
+
+  /**
+   * Input: The new number of symbionts; the pool to take blocks from and
+   * return them to, if any.
+   *
+   * Output: None
+   *
+   * Purpose: To shrink the list, or grow it with null pointers. An empty list
+   * returns its overflow block.
+   */
+  void resize(size_t new_size, emp::Ptr<SymListPool> pool = nullptr) {
+    while (num_items > new_size) pop_back();
+    while (num_items < new_size) push_back(nullptr, pool);
+    if (num_items == 0) ReleaseStorage(pool);
+  }
+
+  void clear(emp::Ptr<SymListPool> pool = nullptr) { resize(0, pool); }
+
+
+  /**
+   * Input: None
+   *
+   * Output: A vector of the symbionts, such as an emp::vector.
+   *
+   * Purpose: To copy the symbionts into a vector.
+   */
+  template <typename VEC_T,
+            typename std::enable_if<std::is_base_of<std::vector<value_type>, VEC_T>::value, bool>::type = true>
+  operator VEC_T() const { return VEC_T(begin(), end()); }
+
+
+  /**
+   * Input: The symbionts to compare to.
+   *
+   * Output: The bool representing if both hold the same symbionts in the
+   * same order.
+   *
+   * Purpose: To compare a SymList to another one or to a vector.
+   */
+  friend bool operator==(const SymList & list, const std::vector<value_type> & vec) {
+    if (list.size() != vec.size()) return false;
+    for (size_t i = 0; i < list.size(); i++) {
+      if (list.items[i] != vec[i]) return false;
+    }
+    return true;
+  }
+  friend bool operator==(const std::vector<value_type> & vec, const SymList & list) { return list == vec; }
+  friend bool operator==(const SymList & a, const SymList & b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+      if (a.items[i] != b.items[i]) return false;
+    }
+    return true;
+  }
+  friend bool operator!=(const SymList & a, const SymList & b) { return !(a == b); }
+
+  /**
+   * Input: A SymList.
+   *
+   * Output: The number of symbionts in it.
+   *
+   * Purpose: To support size(list) like std::size does for vectors.
+   */
+  friend size_t size(const SymList & list) { return list.size(); }
+};
+
+#endif
@@ -7,7 +7,21 @@
 #include "../../Empirical/include/emp/math/random_utils.hpp"
 #include "../../Empirical/include/emp/math/Random.hpp"
 #include "../Organism.h"
+#include "SymDataFile.h"
+#include "AdaptiveTiming.h"
+#include "BinnedPhylogeny.h"
+#include "LineagePhylogeny.h"
+#include "AbundanceIndex.h"
+#include "GenotypeTable.h"
+#include "NeighborTable.h"
+#include "DispersalKernel.h"
+#include "PhaseProfiler.h"
+#include "ObjectCensus.h"
+#include "SymContext.h"
 #include <set>
+#include <memory>
+#include <unordered_map>
+#include <sstream>
 #include <math.h>
 
 
@@ -58,6 +72,146 @@ protected:
   */
   emp::Ptr<emp::Systematics<Organism, int>> sym_sys;
 
+  /**
+    *
+    * Purpose: Represents the binned trackers for hosts and symbionts, used
+    * instead of host_sys and sym_sys when PHYLOGENY_TRACKER is binned.
+    *
+  */
+  emp::Ptr<BinnedPhylogeny> host_bin_sys = nullptr;
+  emp::Ptr<BinnedPhylogeny> sym_bin_sys = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the genotype-level trackers for hosts and symbionts,
+    * used instead of host_sys and sym_sys when PHYLOGENY_TRACKER is lineage.
+    *
+  */
+  emp::Ptr<LineagePhylogeny> host_lineage_sys = nullptr;
+  emp::Ptr<LineagePhylogeny> sym_lineage_sys = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the genotypes of the living hosts and symbionts,
+    * when GENOTYPE_TABLE is on.
+    *
+  */
+  emp::Ptr<GenotypeTable> host_genotypes = nullptr;
+  emp::Ptr<GenotypeTable> sym_genotypes = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the precomputed neighborhoods of the grid cells, and
+    * whether they are used, which they are once the world is a grid.
+    *
+  */
+  NeighborTable neighbor_table;
+  bool use_neighbor_table = false;
+
+  /**
+    *
+    * Purpose: Represents the kernel host offspring and moving free-living
+    * symbionts disperse by, and whether it is used, which it is on a grid
+    * when DISPERSAL_KERNEL is not neighbor.
+    *
+  */
+  DispersalKernel dispersal_kernel;
+  bool use_dispersal_kernel = false;
+
+  /**
+    *
+    * Purpose: Represents the overflow blocks of host symbiont lists that are
+    * not in use, so hosts in this world reuse each other's blocks. Hosts are
+    * deleted in the destructor, before the pool is.
+    *
+  */
+  SymListPool sym_list_pool;
+
+  /**
+    *
+    * Purpose: Represents the random number generator, world and configuration
+    * shared by the organisms of this world, and the contexts of organisms
+    * built for this world with a different random number generator or
+    * configuration.
+    *
+  */
+  SymContext context;
+  emp::vector<emp::Ptr<SymContext>> other_contexts;
+
+  /**
+    *
+    * Purpose: Represents whether the world is in the middle of an Update, during
+    * which symbiont deaths are buffered rather than applied to the systematic.
+    *
+  */
+  bool in_update = false;
+
+  /**
+    *
+    * Purpose: Represents the symbiont deaths buffered during the current update,
+    * one entry per taxon (or lightweight phylogeny entry) with the number of deaths.
+    * The maps give each taxon's or entry's index in the buffer, so that
+    * repeated deaths are coalesced.
+    *
+  */
+  struct SymRemoval {
+    emp::Ptr<emp::Taxon<int>> taxon;
+    size_t phylo_id;
+    size_t count;
+  };
+  emp::vector<SymRemoval> pending_sym_removals;
+  std::unordered_map<emp::Taxon<int> *, size_t> pending_taxon_index;
+  std::unordered_map<size_t, size_t> pending_phylo_index;
+
+  /**
+    *
+    * Purpose: Represents the number of living hosts and symbionts of each taxon,
+    * of free-living and hosted symbionts of each taxon, and of hosted symbionts of
+    * each host taxon and symbiont taxon pair, when the full tracker is used. A
+    * symbiont in a host that has not yet been placed counts as neither free-living
+    * nor hosted.
+    *
+  */
+  using taxon_pair_t = std::pair<emp::Taxon<int> *, emp::Taxon<int> *>;
+  AbundanceIndex<emp::Taxon<int> *> host_taxon_index;
+  AbundanceIndex<emp::Taxon<int> *> sym_taxon_index;
+  AbundanceIndex<emp::Taxon<int> *> free_sym_taxon_index;
+  AbundanceIndex<emp::Taxon<int> *> hosted_sym_taxon_index;
+  AbundanceIndex<taxon_pair_t, PairHash> pair_taxon_index;
+
+  /**
+    *
+    * Purpose: Represents the record stream all data files write to when
+    * SINGLE_DATA_STREAM is on. Created by the first call to SetupFile().
+    *
+  */
+  emp::Ptr<RecordStream> data_stream = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the scheduler deciding when data files print when
+    * ADAPTIVE_DATA is on. Created by the first call to GetDataTimingFun().
+    *
+  */
+  emp::Ptr<AdaptiveTiming> adaptive_timing = nullptr;
+
+  /**
+    *
+    * Purpose: Represents the update of the last TransmissionRates row, used
+    * to print how many updates each row's totals cover when ADAPTIVE_DATA
+    * is on.
+    *
+  */
+  size_t last_transmission_row = 0;
+
+  /**
+    *
+    * Purpose: Represents the profiler timing each phase of the update. Only
+    * created in builds compiled with SYMBULATION_PROFILE.
+    *
+  */
+  emp::Ptr<PhaseProfiler> profiler = nullptr;
+
   emp::Ptr<emp::DataMonitor<double, emp::data::Histogram>> data_node_hostintval; // New() reallocates this pointer
   emp::Ptr<emp::DataMonitor<double, emp::data::Histogram>> data_node_symintval;
   emp::Ptr<emp::DataMonitor<double, emp::data::Histogram>> data_node_freesymintval;
@@ -76,6 +230,15 @@ protected:
 
 
 public:
+  /**
+    *
+    * Purpose: Represents the most cells a world can have. Positions are
+    * emp::WorldPositions, which hold 32-bit indices and reserve the largest
+    * one to mark invalid positions.
+    *
+  */
+  static constexpr size_t MAX_CELLS = emp::WorldPosition::invalid_id;
+
   /**
    * Input: The world's random seed
    *
@@ -83,14 +246,34 @@ public:
    *
    * Purpose: To construct an instance of SymWorld
    */
-  SymWorld(emp::Random & _random, emp::Ptr<SymConfigBase> _config) : emp::World<Organism>(_random) {
+  SymWorld(emp::Random & _random, emp::Ptr<SymConfigBase> _config) : emp::World<Organism>(_random), context{&_random, this, _config} {
     fun_print_org = [](Organism & org, std::ostream & os) {
       //os << PrintHost(&org);
       os << "This doesn't work currently";
     };
     my_config = _config;
     total_res = my_config->LIMITED_RES_TOTAL();
-    if (my_config->PHYLOGENY() == true){
+    std::string kernel = my_config->DISPERSAL_KERNEL();
+    if (kernel != "neighbor" && kernel != "exponential" && kernel != "power_law"){
+      throw "Invalid DISPERSAL_KERNEL. Must be neighbor, exponential or power_law";
+    }
+    std::string tracker = my_config->PHYLOGENY_TRACKER();
+    if (my_config->PHYLOGENY() == true && tracker != "full" && tracker != "binned" && tracker != "lineage"){
+      throw "Invalid PHYLOGENY_TRACKER. Must be full, binned or lineage";
+    }
+    if (my_config->PHYLOGENY() == true && tracker == "binned"){
+      host_bin_sys = emp::NewPtr<BinnedPhylogeny>(my_config->NUM_PHYLO_BINS());
+      sym_bin_sys = emp::NewPtr<BinnedPhylogeny>(my_config->NUM_PHYLO_BINS());
+      //host births are recorded in AddOrgAt, deaths by any route are caught here
+      OnOrgDeath([this](size_t pos){ host_bin_sys->RemoveOrgAt(pos, GetUpdate()); });
+    }
+    else if (my_config->PHYLOGENY() == true && tracker == "lineage"){
+      if (my_config->PHYLOGENY_PRUNE_INT() < 1) throw "Invalid PHYLOGENY_PRUNE_INT. Must be at least 1";
+      host_lineage_sys = emp::NewPtr<LineagePhylogeny>();
+      sym_lineage_sys = emp::NewPtr<LineagePhylogeny>();
+      OnOrgDeath([this](size_t pos){ host_lineage_sys->RemoveOrgAt(pos, GetUpdate()); });
+    }
+    else if (my_config->PHYLOGENY() == true){
       host_sys = emp::NewPtr<emp::Systematics<Organism, int>>(GetCalcInfoFun());
       sym_sys = emp::NewPtr< emp::Systematics<Organism, int>>(GetCalcInfoFun());
 
@@ -99,7 +282,24 @@ public:
 
       sym_sys-> AddSnapshotFun( [](const emp::Taxon<int> & t){return std::to_string(t.GetInfo());}, "info");
       host_sys->AddSnapshotFun( [](const emp::Taxon<int> & t){return std::to_string(t.GetInfo());}, "info");
+      //host placements are indexed in AddOrgAt, deaths by any route are caught here
+      OnOrgDeath([this](size_t pos){ host_taxon_index.Remove(pop[pos]->GetTaxon().Raw()); });
+    }
+    if (my_config->GENOTYPE_TABLE()){
+      host_genotypes = emp::NewPtr<GenotypeTable>();
+      sym_genotypes = emp::NewPtr<GenotypeTable>();
+      //host placements are added in AddOrgAt, deaths by any route are caught here
+      OnOrgDeath([this](size_t pos){ RemoveFromGenotypes(pop[pos]); });
+    }
+#ifdef SYMBULATION_PROFILE
+    std::string file_ending = my_config->FILE_NAME()+"_SEED"+std::to_string(my_config->SEED());
+    profiler = emp::NewPtr<PhaseProfiler>(my_config->FILE_PATH()+"Timing"+file_ending+".data",
+                                          my_config->FILE_PATH()+"Trace"+file_ending+".json",
+                                          my_config->DATA_INT());
+    if(!profiler->EnableCounters(my_config->FILE_PATH()+"PerfCounters"+file_ending+".data")){
+      std::cout << "Hardware performance counters are unavailable, only phase times will be profiled" << std::endl;
     }
+#endif
   }
 
 
@@ -124,7 +324,7 @@ public:
     if (data_node_hostedsymcount) data_node_hostedsymcount.Delete();
     if (data_node_uninf_hosts) data_node_uninf_hosts.Delete();
     if (data_node_attempts_horiztrans) data_node_attempts_horiztrans.Delete();
-    if (data_node_attempts_horiztrans) data_node_successes_horiztrans.Delete();
+    if (data_node_successes_horiztrans) data_node_successes_horiztrans.Delete();
     if (data_node_attempts_verttrans) data_node_attempts_verttrans.Delete();
 
     for(size_t i = 0; i < sym_pop.size(); i++){ //host population deletion is handled by empirical world destructor
@@ -133,9 +333,33 @@ public:
       }
     }
 
-    if(my_config->PHYLOGENY()){ //host systematic deletion is handled by empirical world destructor
+    //remove the hosts and their symbionts now, while the trackers and the symbiont list pool still exist
+    Clear();
+    if(sym_sys){ //host systematic deletion is handled by empirical world destructor
       sym_sys.Delete();
     }
+    if(host_bin_sys){
+      host_bin_sys.Delete();
+      sym_bin_sys.Delete();
+    }
+    if(profiler){
+      profiler.Delete();
+    }
+    if(host_lineage_sys){
+      host_lineage_sys.Delete();
+      sym_lineage_sys.Delete();
+    }
+    if(host_genotypes){
+      host_genotypes.Delete();
+      sym_genotypes.Delete();
+    }
+    for(emp::Ptr<SymContext> other : other_contexts){
+      other.Delete();
+    }
+
+    //data files are deleted by the empirical world destructor, but never write to the stream when deleted
+    if (data_stream) data_stream.Delete();
+    if (adaptive_timing) adaptive_timing.Delete();
   }
 
 
@@ -207,6 +431,133 @@ public:
   }
 
 
+  /**
+   * Input: None
+   *
+   * Output: The binned tracker for hosts, or nullptr if PHYLOGENY_TRACKER is not binned
+   *
+   * Purpose: To retrieve the host binned phylogeny
+   */
+  emp::Ptr<BinnedPhylogeny> GetHostBinSys(){
+    return host_bin_sys;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The binned tracker for symbionts, or nullptr if PHYLOGENY_TRACKER is not binned
+   *
+   * Purpose: To retrieve the symbiont binned phylogeny
+   */
+  emp::Ptr<BinnedPhylogeny> GetSymBinSys(){
+    return sym_bin_sys;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The genotype-level tracker for hosts, or nullptr if PHYLOGENY_TRACKER is not lineage
+   *
+   * Purpose: To retrieve the host lineage phylogeny
+   */
+  emp::Ptr<LineagePhylogeny> GetHostLineageSys(){
+    return host_lineage_sys;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The genotype-level tracker for symbionts, or nullptr if PHYLOGENY_TRACKER is not lineage
+   *
+   * Purpose: To retrieve the symbiont lineage phylogeny
+   */
+  emp::Ptr<LineagePhylogeny> GetSymLineageSys(){
+    return sym_lineage_sys;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The table of host genotypes, or nullptr if GENOTYPE_TABLE is off
+   *
+   * Purpose: To retrieve the host genotypes
+   */
+  emp::Ptr<GenotypeTable> GetHostGenotypes(){
+    return host_genotypes;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The table of symbiont genotypes, or nullptr if GENOTYPE_TABLE is off
+   *
+   * Purpose: To retrieve the symbiont genotypes
+   */
+  emp::Ptr<GenotypeTable> GetSymGenotypes(){
+    return sym_genotypes;
+  }
+
+
+  /**
+   * Input: The organism to add to the genotype table.
+   *
+   * Output: None
+   *
+   * Purpose: To count a new host or symbiont in the table of its genotype, if
+   * GENOTYPE_TABLE is on. Organisms are added once their mutations are done:
+   * symbionts when they are born or injected, and hosts when they are placed.
+   */
+  void AddToGenotypes(emp::Ptr<Organism> org){
+    if (!host_genotypes) return;
+    emp::Ptr<GenotypeTable> table = org->IsHost() ? host_genotypes : sym_genotypes;
+    Genotype genotype;
+    org->AddToGenotype(genotype);
+    table->Add(genotype);
+    org->SetInGenotypes(true);
+  }
+
+
+  /**
+   * Input: The organism to remove from the genotype table.
+   *
+   * Output: None
+   *
+   * Purpose: To remove a dying host or symbiont from the count of its
+   * genotype, if it was added to one. Its traits have not changed since it
+   * was added, so they identify its entry.
+   */
+  void RemoveFromGenotypes(emp::Ptr<Organism> org){
+    if (!host_genotypes || !org->IsInGenotypes()) return;
+    emp::Ptr<GenotypeTable> table = org->IsHost() ? host_genotypes : sym_genotypes;
+    Genotype genotype;
+    org->AddToGenotype(genotype);
+    table->Remove(genotype);
+    org->SetInGenotypes(false);
+  }
+
+
+  /**
+   * Input: A host or symbiont.
+   *
+   * Output: The organism's entry in its genotype table, or nullptr if it is
+   * not in one.
+   *
+   * Purpose: To retrieve an organism's genotype.
+   */
+  emp::Ptr<const Genotype> GetGenotype(emp::Ptr<Organism> org){
+    if (!host_genotypes || !org->IsInGenotypes()) return nullptr;
+    emp::Ptr<GenotypeTable> table = org->IsHost() ? host_genotypes : sym_genotypes;
+    Genotype genotype;
+    org->AddToGenotype(genotype);
+    return table->Find(genotype);
+  }
+
+
   /**
    * Input: None
    *
@@ -234,19 +585,138 @@ public:
   }
 
   /**
-   * Input: The symbiont to be added to the systematic
+   * Input: The symbiont to be added to the systematic; optionally the taxon
+   * of its parent and its parent.
    *
-   * Output: the taxon the symbiont is added to.
+   * Output: the taxon the symbiont is added to, or nullptr if PHYLOGENY_TRACKER
+   * is binned or lineage.
    *
    * Purpose: To add a symbiont to the systematic and to set it to track its taxon
    */
-  emp::Ptr<emp::Taxon<int>> AddSymToSystematic(emp::Ptr<Organism> sym, emp::Ptr<emp::Taxon<int>> parent_taxon=nullptr){
+  emp::Ptr<emp::Taxon<int>> AddSymToSystematic(emp::Ptr<Organism> sym, emp::Ptr<emp::Taxon<int>> parent_taxon=nullptr, emp::Ptr<Organism> parent=nullptr){
+    if (sym_bin_sys) {
+      size_t parent_bin = parent ? parent->GetPhyloID() : BinnedPhylogeny::NO_BIN;
+      sym->SetPhyloID(sym_bin_sys->AddOrg(GetCalcInfoFun()(*sym), parent_bin, GetUpdate()));
+      return nullptr;
+    }
+    if (sym_lineage_sys) {
+      size_t parent_node = parent ? parent->GetPhyloID() : LineagePhylogeny::NO_NODE;
+      sym->SetPhyloID(sym_lineage_sys->AddOrg(sym->GetIntVal(), parent_node, GetUpdate()));
+      return nullptr;
+    }
     emp::Ptr<emp::Taxon<int>> taxon = sym_sys->AddOrg(*sym, emp::WorldPosition(0,0), parent_taxon, GetUpdate());
     sym->SetTaxon(taxon);
+    IndexSym(taxon, sym->GetHost(), 1);
     return taxon;
   }
 
 
+  /**
+   * Input: The taxon of a symbiont; its host, or nullptr if it is free-living;
+   * 1 if the symbiont arrived there or -1 if it left.
+   *
+   * Output: None
+   *
+   * Purpose: To update the free-living, hosted and pair abundance indices when a
+   * symbiont moves. Only the full tracker is indexed.
+   */
+  void IndexSymLocation(emp::Ptr<emp::Taxon<int>> taxon, emp::Ptr<Organism> host, int change){
+    if (!host_sys || !taxon) return;
+    emp::Taxon<int> * sym_key = taxon.Raw();
+    if (!host) {
+      if (change > 0) free_sym_taxon_index.Add(sym_key);
+      else free_sym_taxon_index.Remove(sym_key);
+      return;
+    }
+    emp::Taxon<int> * host_key = host->GetTaxon().Raw();
+    if (!host_key) return; //the host has not been placed yet
+    if (change > 0) {
+      hosted_sym_taxon_index.Add(sym_key);
+      pair_taxon_index.Add({host_key, sym_key});
+    } else {
+      hosted_sym_taxon_index.Remove(sym_key);
+      pair_taxon_index.Remove({host_key, sym_key});
+    }
+  }
+
+
+  /**
+   * Input: The taxon of a symbiont; its host, or nullptr if it is free-living;
+   * 1 if the symbiont was born or -1 if it died.
+   *
+   * Output: None
+   *
+   * Purpose: To update every symbiont abundance index for a birth or death.
+   */
+  void IndexSym(emp::Ptr<emp::Taxon<int>> taxon, emp::Ptr<Organism> host, int change){
+    if (!host_sys || !taxon) return;
+    if (change > 0) sym_taxon_index.Add(taxon.Raw());
+    else sym_taxon_index.Remove(taxon.Raw());
+    IndexSymLocation(taxon, host, change);
+  }
+
+
+  /**
+   * Input: The taxon of the symbiont being removed; its entry in the
+   * lightweight phylogeny tracker.
+   *
+   * Output: None
+   *
+   * Purpose: To remove a dying symbiont from whichever systematic is tracking it.
+   * During an update, the death is buffered and applied with the others at the
+   * end of the update by ApplySymRemovals.
+   */
+  void RemoveSymFromSystematic(emp::Ptr<emp::Taxon<int>> taxon, size_t phylo_id){
+    if (!in_update) {
+      if (sym_bin_sys) sym_bin_sys->RemoveOrg(phylo_id, GetUpdate());
+      else if (sym_lineage_sys) sym_lineage_sys->RemoveOrg(phylo_id, GetUpdate());
+      else sym_sys->RemoveOrg(taxon, GetUpdate());
+      return;
+    }
+
+    size_t index;
+    if (sym_sys) {
+      auto found = pending_taxon_index.find(taxon.Raw());
+      if (found == pending_taxon_index.end()) {
+        index = pending_sym_removals.size();
+        pending_taxon_index[taxon.Raw()] = index;
+        pending_sym_removals.push_back({taxon, phylo_id, 0});
+      } else index = found->second;
+    } else {
+      auto found = pending_phylo_index.find(phylo_id);
+      if (found == pending_phylo_index.end()) {
+        index = pending_sym_removals.size();
+        pending_phylo_index[phylo_id] = index;
+        pending_sym_removals.push_back({taxon, phylo_id, 0});
+      } else index = found->second;
+    }
+    pending_sym_removals[index].count++;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To apply the symbiont deaths buffered during the current update,
+   * in the order each taxon first lost a symbiont. The lightweight trackers
+   * remove all of a taxon's deaths at once.
+   */
+  void ApplySymRemovals(){
+    for (SymRemoval & removal : pending_sym_removals) {
+      if (sym_bin_sys) sym_bin_sys->RemoveOrg(removal.phylo_id, GetUpdate(), removal.count);
+      else if (sym_lineage_sys) sym_lineage_sys->RemoveOrg(removal.phylo_id, GetUpdate(), removal.count);
+      else {
+        for (size_t i = 0; i < removal.count; i++) sym_sys->RemoveOrg(removal.taxon, GetUpdate());
+      }
+    }
+    pending_sym_removals.clear();
+    pending_taxon_index.clear();
+    pending_phylo_index.clear();
+  }
+
+
   /**
    * Input: The amount of resources an organism wants from the world.
    *
@@ -287,6 +757,111 @@ public:
     size_t new_size = new_width * new_height;
     Resize(new_size);
     pop_sizes[0] = new_width; pop_sizes[1] = new_height;
+    if (use_neighbor_table) BuildNeighborTable();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: None
+   *
+   * Purpose: To (re)build the neighborhoods of the grid cells for the
+   * current width and height and the GRID_TOPOLOGY, GRID_RADIUS and GRID_WRAP
+   * settings.
+   */
+  void BuildNeighborTable() {
+    neighbor_table.Build(GetWidth(), GetHeight(), my_config->GRID_TOPOLOGY(),
+                         my_config->GRID_RADIUS(), my_config->GRID_WRAP());
+  }
+
+
+  /**
+   * Input: The size_t representing the world's width;
+   * the size_t representing the world's height;
+   * the bool representing whether generations are synchronous.
+   *
+   * Output: None
+   *
+   * Purpose: To overwrite the Empirical grid structure so that random
+   * neighbors, and so offspring positions, are drawn from the precomputed
+   * neighborhoods of the configured topology.
+   */
+  void SetPopStruct_Grid(size_t width, size_t height, bool synchronous_gen=false) {
+    emp::World<Organism>::SetPopStruct_Grid(width, height, synchronous_gen);
+    use_neighbor_table = true;
+    BuildNeighborTable();
+    fun_get_neighbor = [this](emp::WorldPosition pos) {
+      return pos.SetIndex(neighbor_table.GetRandomNeighbor(pos.GetIndex(), GetRandom()));
+    };
+
+    use_dispersal_kernel = my_config->DISPERSAL_KERNEL() != "neighbor";
+    if (use_dispersal_kernel) {
+      dispersal_kernel.Build(my_config->DISPERSAL_KERNEL(), my_config->DISPERSAL_SCALE(),
+                             my_config->DISPERSAL_EXPONENT(), my_config->DISPERSAL_MAX_DIST(),
+                             my_config->GRID_TOPOLOGY() == "hex");
+      fun_find_birth_pos = [this](emp::Ptr<Organism>, emp::WorldPosition parent_pos) {
+        return GetDispersalPos(parent_pos);
+      };
+    }
+  }
+
+
+  /**
+   * Input: The world position being dispersed from.
+   *
+   * Output: The position dispersed to, which is invalid if the dispersal left
+   * a grid that does not wrap.
+   *
+   * Purpose: To draw where an offspring or moving free-living symbiont lands,
+   * from the dispersal kernel if there is one and from the neighborhood
+   * otherwise.
+   */
+  emp::WorldPosition GetDispersalPos(emp::WorldPosition pos) {
+    if (!use_dispersal_kernel) return GetRandomNeighborPos(pos);
+    size_t target = dispersal_kernel.Disperse(pos.GetIndex(), GetWidth(), GetHeight(),
+                                              my_config->GRID_WRAP(), GetRandom());
+    if (target == (size_t) -1) return emp::WorldPosition();
+    return pos.SetIndex(target);
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The precomputed neighborhoods of the grid cells.
+   *
+   * Purpose: To allow access to the neighborhoods of a grid world.
+   */
+  const NeighborTable & GetNeighborTable() const { return neighbor_table; }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The pool of symbiont list blocks.
+   *
+   * Purpose: To let hosts take and return the blocks of their symbiont lists.
+   */
+  SymListPool & GetSymListPool() { return sym_list_pool; }
+
+
+  /**
+   * Input: The random number generator and configuration of an organism.
+   *
+   * Output: The context the organism should hold.
+   *
+   * Purpose: To give an organism built for this world the world's context,
+   * or a context of its own random number generator and configuration if
+   * they are not the world's.
+   */
+  emp::Ptr<SymContext> GetContext(emp::Ptr<emp::Random> _random, emp::Ptr<SymConfigBase> _config) {
+    if (context.Matches(_random, this, _config)) return &context;
+    for (emp::Ptr<SymContext> other : other_contexts) {
+      if (other->Matches(_random, this, _config)) return other;
+    }
+    other_contexts.push_back(emp::NewPtr<SymContext>(SymContext{_random, this, _config}));
+    return other_contexts.back();
   }
 
 
@@ -297,9 +872,10 @@ public:
    *
    * Purpose: To override the Empirical Resize function with
    * a single-arg method that can be used for AddOrgAt vector
-   * expansions
+   * expansions. Throws if the world would be larger than MAX_CELLS.
    */
   void Resize(size_t new_size){
+    if (new_size > MAX_CELLS) throw "World size exceeds the 32-bit positions of emp::WorldPosition";
     pop.resize(new_size);
     sym_pop.resize(new_size);
     pop_sizes.resize(2);
@@ -330,7 +906,21 @@ public:
     }
 
     if(new_org->IsHost()){ //if the org is a host, use the empirical addorgat function
+      size_t parent_bin = BinnedPhylogeny::NO_BIN;
+      size_t parent_node = LineagePhylogeny::NO_NODE;
+      if(host_bin_sys && p_pos.IsValid()) parent_bin = host_bin_sys->GetBinAt(p_pos.GetIndex());
+      if(host_lineage_sys && p_pos.IsValid()) parent_node = host_lineage_sys->GetNodeAt(p_pos.GetIndex());
       emp::World<Organism>::AddOrgAt(new_org, pos, p_pos);
+      if(host_bin_sys) host_bin_sys->AddOrgAt(pos.GetIndex(), GetCalcInfoFun()(*new_org), parent_bin, GetUpdate());
+      if(host_lineage_sys) host_lineage_sys->AddOrgAt(pos.GetIndex(), new_org->GetIntVal(), parent_node, GetUpdate());
+      if(host_sys){
+        //symbionts that arrived before the host was placed become hosted now
+        SymList & host_syms = new_org->GetSymbionts();
+        new_org->SetTaxon(host_sys->GetTaxonAt(pos));
+        host_taxon_index.Add(new_org->GetTaxon().Raw());
+        for (emp::Ptr<Organism> sym : host_syms) IndexSymLocation(sym->GetTaxon(), new_org, 1);
+      }
+      AddToGenotypes(new_org);
 
     } else { //if it is not a host, then add it to the sym population
       //for symbionts, their place in their host's world is indicated by their ID
@@ -358,6 +948,7 @@ public:
    * Purpose: To introduce new organisms to the world.
    */
   emp::WorldPosition DoBirth(emp::Ptr<Organism> new_org, emp::WorldPosition p_pos) {
+    SYM_PROFILE_SCOPE(profiler, BIRTH);
     size_t parent_pos = p_pos.GetIndex();
     before_repro_sig.Trigger(parent_pos);
     emp::WorldPosition pos; // Position of each offspring placed.
@@ -379,26 +970,37 @@ public:
    * Input: The size_t value representing the location whose neighbors
    * are being searched.
    *
-   * Output: If there are no occupied neighboring positions, -1 will be returned.
-   * If there are occupied neighboring positions, then the location of one
-   * occupied position will be returned.
+   * Output: If there are no occupied neighboring positions, an invalid position
+   * will be returned. If there are occupied neighboring positions, then the
+   * position of one of them will be returned.
    *
    * Purpose: To determine the location of a valid occupied neighboring position.
    */
-  int GetNeighborHost (size_t id) {
+  emp::WorldPosition GetNeighborHost (size_t id) {
     // Attempt to use GetRandomNeighborPos first, since it's much faster
     for (int i = 0; i < 3; i++) {
       emp::WorldPosition neighbor = GetRandomNeighborPos(id);
       if (neighbor.IsValid() && IsOccupied(neighbor))
-        return neighbor.GetIndex();
+        return emp::WorldPosition(neighbor.GetIndex());
     }
 
-    // Then enumerate all occupied neighbors, in case many neighbors are unoccupied
+    // Then pick among all occupied neighbors, in case many neighbors are unoccupied.
+    // Empirical only knows its own neighborhood, so other topologies walk the table.
+    if (use_neighbor_table && !neighbor_table.IsEmpiricalGrid()) {
+      NeighborTable::Neighbors neighbors = neighbor_table.GetNeighbors(id);
+      size_t num_valid = 0;
+      for (uint32_t neighbor : neighbors) if (neighbor != id && IsOccupied(neighbor)) num_valid++;
+      if (num_valid == 0) return emp::WorldPosition();
+      size_t randI = GetRandom().GetUInt(0, num_valid);
+      for (uint32_t neighbor : neighbors) {
+        if (neighbor != id && IsOccupied(neighbor) && randI-- == 0) return emp::WorldPosition(neighbor);
+      }
+    }
     const emp::vector<size_t> validNeighbors = GetValidNeighborOrgIDs(id);
-    if (validNeighbors.empty()) return -1;
+    if (validNeighbors.empty()) return emp::WorldPosition();
     else {
-      int randI = GetRandom().GetUInt(0, validNeighbors.size());
-      return validNeighbors[randI];
+      size_t randI = GetRandom().GetUInt(0, validNeighbors.size());
+      return emp::WorldPosition(validNeighbors[randI]);
     }
   }
 
@@ -413,6 +1015,7 @@ public:
   void InjectSymbiont(emp::Ptr<Organism> new_sym){
     size_t new_loc;
     if (my_config->PHYLOGENY()) AddSymToSystematic(new_sym);
+    AddToGenotypes(new_sym);
     if(my_config->FREE_LIVING_SYMS() == 0){
       new_loc = GetRandomOrgID();
       //if the position is acceptable, add the sym to the host in that position
@@ -429,6 +1032,190 @@ public:
   }
 
 
+  /**
+   * Input: The name of a data file, such as "HostVals"; optionally the key of
+   * one of its columns, or "Hist" for all of its histogram columns.
+   *
+   * Output: The bool representing if the file or column should be written.
+   *
+   * Purpose: To check DATA_MANIFEST, a comma separated list of files
+   * ("HostVals") and columns ("HostVals:count") to write, or "all". A file is
+   * enabled if it or any of its columns is listed; listing a file on its own
+   * enables all of its columns. Whitespace around entries and their colons
+   * is ignored. Data nodes are only requested, and so only register their
+   * update scans, for enabled columns.
+   */
+  bool IsDataEnabled(const std::string & file, const std::string & column = "") {
+    auto trim = [](const std::string & text) {
+      size_t first = text.find_first_not_of(" \t");
+      if (first == std::string::npos) return std::string();
+      return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    };
+    std::string manifest = trim(my_config->DATA_MANIFEST());
+    if (manifest == "all") return true;
+
+    std::stringstream entries(manifest);
+    std::string entry;
+    while (std::getline(entries, entry, ',')) {
+      entry = trim(entry);
+      size_t colon = entry.find(':');
+      if (colon != std::string::npos) entry = trim(entry.substr(0, colon)) + ":" + trim(entry.substr(colon + 1));
+      if (entry == file) return true;
+      if (column == "" && entry.rfind(file + ":", 0) == 0) return true;
+      if (column != "" && entry == file + ":" + column) return true;
+    }
+    return false;
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The standard function object that data files use to decide
+   * whether to print a row at a given update.
+   *
+   * Purpose: To give every data file the same timing. Without ADAPTIVE_DATA,
+   * files print every DATA_INT updates. With it, all files share one
+   * AdaptiveTiming that prints at least every DATA_INT updates, more often
+   * while host and symbiont statistics are changing, and at high resolution
+   * after an extinction.
+   */
+  std::function<bool(size_t)> GetDataTimingFun() {
+    size_t timing_repeat = my_config->DATA_INT();
+    if (!my_config->ADAPTIVE_DATA()) {
+      return [timing_repeat](size_t ud){ return ud % timing_repeat == 0; };
+    }
+
+    if (!adaptive_timing) {
+      adaptive_timing = emp::NewPtr<AdaptiveTiming>(my_config->ADAPTIVE_MIN_INT(), timing_repeat,
+        my_config->ADAPTIVE_EVENT_WINDOW(), my_config->ADAPTIVE_COUNT_CHANGE(),
+        my_config->ADAPTIVE_INTVAL_CHANGE(), my_config->ADAPTIVE_HIST_CHANGE());
+    }
+    //request the nodes now, so that their scans are registered before the first update
+    auto & host_count_node = GetHostCountDataNode();
+    auto & sym_count_node = GetSymCountDataNode();
+    auto & host_intval_node = GetHostIntValDataNode();
+    auto & sym_intval_node = GetSymIntValDataNode();
+
+    return [this, &host_count_node, &sym_count_node, &host_intval_node, &sym_intval_node](size_t ud){
+      if (adaptive_timing->HasDecided(ud)) return adaptive_timing->GetDecision();
+      AdaptiveTiming::Stats stats;
+      stats.host_count = host_count_node.GetTotal();
+      stats.sym_count = sym_count_node.GetTotal();
+      stats.host_mean = host_intval_node.GetMean();
+      stats.sym_mean = sym_intval_node.GetMean();
+      stats.host_hist = host_intval_node.GetHistCounts();
+      stats.sym_hist = sym_intval_node.GetHistCounts();
+      return adaptive_timing->ShouldPrint(ud, stats);
+    };
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The 64-bit digest of the world's state.
+   *
+   * Purpose: To fingerprint the state of the world, so that two builds can be
+   * checked for producing exactly the same run. The digest covers the update,
+   * total_res, the state of the random number generator, and every host (with
+   * its symbionts and reproductive symbionts, in order) and free-living
+   * symbiont by position, including all of their traits.
+   */
+  uint64_t StateDigest() {
+    StateHasher hasher;
+    hasher.Add(GetUpdate());
+    hasher.Add(total_res);
+    //fingerprint the generator by drawing from a copy, so the run is not disturbed
+    emp::Random random_copy(GetRandom());
+    for (size_t i = 0; i < 4; i++) hasher.Add(random_copy.GetDouble());
+
+    hasher.Add(pop.size());
+    for (size_t i = 0; i < pop.size(); i++) {
+      hasher.Add(IsOccupied(i));
+      if (IsOccupied(i)) pop[i]->AddToDigest(hasher);
+    }
+    hasher.Add(sym_pop.size());
+    for (size_t i = 0; i < sym_pop.size(); i++) {
+      hasher.Add((bool) sym_pop[i]);
+      if (sym_pop[i]) sym_pop[i]->AddToDigest(hasher);
+    }
+    return hasher.GetDigest();
+  }
+
+
+  /**
+   * Input: None
+   *
+   * Output: The pointer to the record stream shared by the world's data files.
+   *
+   * Purpose: To retrieve the run's record stream, creating it on first use.
+   */
+  emp::Ptr<RecordStream> GetDataStream() {
+    if (!data_stream) {
+      std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".stream";
+      data_stream = emp::NewPtr<RecordStream>(my_config->FILE_PATH()+"DataStream"+my_config->FILE_NAME()+file_ending);
+    }
+    return data_stream;
+  }
+
+
+  /**
+   * Input: The address of the string representing the name of the file to be created.
+   *
+   * Output: The address of the SymDataFile that has been created.
+   *
+   * Purpose: To hide the Empirical SetupFile so that every data file the world
+   * manages is a SymDataFile configured by the world's output settings. With
+   * SINGLE_DATA_STREAM on, the file becomes a series of the run's record stream
+   * and no file of its own is created.
+   */
+  SymDataFile & SetupFile(const std::string & filename) {
+    bool delta_encode = my_config->DELTA_ENCODE_DATA();
+    std::string file_name = filename;
+    if (delta_encode) file_name += DELTA_FILE_SUFFIX;
+
+    emp::Ptr<SymDataFile> file;
+    if (my_config->SINGLE_DATA_STREAM()) {
+      file = emp::NewPtr<SymDataFile>(GetDataStream(), file_name);
+    } else {
+      file = emp::NewPtr<SymDataFile>(file_name);
+    }
+    file->SetDeltaEncoding(delta_encode);
+    file->SetProfiler(profiler);
+    AddDataFile(file);
+    return *file;
+  }
+
+
+  /**
+   * Input: The census file; the prefix of the columns, such as "host".
+   *
+   * Output: None
+   *
+   * Purpose: To add the number of live objects of class T, and the number
+   * born and deleted since the previous row, to the census file. T must
+   * inherit from CensusCounter<T>.
+   */
+  template <typename T>
+  void AddCensusColumns(SymDataFile & file, const std::string & prefix) {
+    file.AddCell([](std::string & out){ AppendNumber(out, CensusCounter<T>::GetNumLive()); },
+                 prefix + "_live", "Number of live " + prefix + " objects");
+    auto last_births = std::make_shared<size_t>(CensusCounter<T>::GetNumBirths());
+    file.AddCell([last_births](std::string & out){
+                   size_t births = CensusCounter<T>::GetNumBirths();
+                   AppendNumber(out, births - *last_births);
+                   *last_births = births;
+                 }, prefix + "_births", "Number of " + prefix + " objects created since the previous row");
+    auto last_deletions = std::make_shared<size_t>(CensusCounter<T>::GetNumDeletions());
+    file.AddCell([last_deletions](std::string & out){
+                   size_t deletions = CensusCounter<T>::GetNumDeletions();
+                   AppendNumber(out, deletions - *last_deletions);
+                   *last_deletions = deletions;
+                 }, prefix + "_deletions", "Number of " + prefix + " objects deleted since the previous row");
+  }
+
+
   /**
    * Definitions of data node functions, expanded in DataNodes.h
    */
@@ -438,11 +1225,16 @@ public:
   emp::Ptr<emp::Taxon<int>> GetDominantSymTaxon();
   emp::Ptr<emp::Taxon<int>> GetDominantHostTaxon();
   emp::vector<emp::Ptr<emp::Taxon<int>>> GetDominantFreeHostedSymTaxon();
+  std::pair<emp::Ptr<emp::Taxon<int>>, emp::Ptr<emp::Taxon<int>>> GetDominantPair();
   emp::DataFile & SetupSymIntValFile(const std::string & filename);
   emp::DataFile & SetupHostIntValFile(const std::string & filename);
   emp::DataFile & SetUpFreeLivingSymFile(const std::string & filename);
   emp::DataFile & SetUpTransmissionFile(const std::string & filename);
-  virtual void SetupHostFileColumns(emp::DataFile & file);
+  virtual void SetupHostFileColumns(SymDataFile & file);
+  emp::DataFile & SetupCensusFile(const std::string & filename);
+  emp::DataFile & SetupStateDigestFile(const std::string & filename);
+  emp::DataFile & SetupGenotypeFile(const std::string & filename);
+  virtual void SetupCensusColumns(SymDataFile & file);
   emp::DataMonitor<int>& GetHostCountDataNode();
   emp::DataMonitor<int>& GetSymCountDataNode();
   emp::DataMonitor<int>& GetCountHostedSymsDataNode();
@@ -470,9 +1262,9 @@ public:
    */
   emp::WorldPosition MoveIntoNewFreeWorldPos(emp::Ptr<Organism> sym, emp::WorldPosition parent_pos){
     size_t i = parent_pos.GetPopID();
-    emp::WorldPosition indexed_id = GetRandomNeighborPos(i);
+    emp::WorldPosition indexed_id = GetDispersalPos(i);
     emp::WorldPosition new_pos = emp::WorldPosition(0, indexed_id.GetIndex());
-    if(IsInboundsPos(new_pos)){
+    if(indexed_id.IsValid() && IsInboundsPos(new_pos)){
       sym->SetHost(nullptr);
       AddOrgAt(sym, new_pos, parent_pos);
       return new_pos;
@@ -516,13 +1308,14 @@ public:
    * no eligible near-by hosts.
    */
    emp::WorldPosition SymDoBirth(emp::Ptr<Organism> sym_baby, emp::WorldPosition parent_pos) {
+    SYM_PROFILE_SCOPE(profiler, BIRTH);
     size_t i = parent_pos.GetPopID();
     if(my_config->FREE_LIVING_SYMS() == 0){
-      int new_host_pos = GetNeighborHost(i);
-      if (new_host_pos > -1) { //-1 means no living neighbors
-        int new_index = pop[new_host_pos]->AddSymbiont(sym_baby);
+      emp::WorldPosition new_host_pos = GetNeighborHost(i);
+      if (new_host_pos.IsValid()) { //invalid means no living neighbors
+        int new_index = pop[new_host_pos.GetIndex()]->AddSymbiont(sym_baby);
         if(new_index > 0){ //sym successfully infected
-          return emp::WorldPosition(new_index, new_host_pos);
+          return emp::WorldPosition(new_index, new_host_pos.GetIndex());
         } else { //sym got killed trying to infect
           return emp::WorldPosition();
         }
@@ -636,12 +1429,15 @@ public:
   void RunExperiment(bool verbose=true) {
     //Loop through updates
     int numupdates = my_config->UPDATES();
-    for (int i = 0; i < numupdates; i++) {
-      if(verbose && (i%my_config->DATA_INT())==0) {
-        std::cout <<"Update: "<< i << std::endl;
-        std::cout.flush();
+    {
+      SYM_PROFILE_SCOPE(profiler, RUN);
+      for (int i = 0; i < numupdates; i++) {
+        if(verbose && (i%my_config->DATA_INT())==0) {
+          std::cout <<"Update: "<< i << std::endl;
+          std::cout.flush();
+        }
+        Update();
       }
-      Update();
     }
 
     int num_no_mut_updates = my_config->NO_MUT_UPDATES();
@@ -652,6 +1448,7 @@ public:
       my_config->SYM_VERT_TRANS_RES(0);
     }
 
+    SYM_PROFILE_SCOPE(profiler, NO_MUT_RUN);
     for (int i = 0; i < num_no_mut_updates; i++) {
       if(verbose && (i%my_config->DATA_INT())==0) {
         std::cout <<"No mutation update: "<< i << std::endl;
@@ -670,30 +1467,52 @@ public:
    * Purpose: To simulate a timestep in the world, which includes calling the process functions for hosts and symbionts and updating the data nodes.
    */
   void Update() {
-    emp::World<Organism>::Update();
+    SYM_PROFILE_SCOPE(profiler, UPDATE);
+    {
+      //data node scans and data file output happen inside the Empirical update
+      SYM_PROFILE_SCOPE(profiler, STATS);
+      emp::World<Organism>::Update();
+    }
 
     // Handle resource inflow
     if (total_res != -1) {
       total_res += my_config->LIMITED_RES_INFLOW();
     }
 
-    if(my_config->PHYLOGENY()) sym_sys->Update(); //sym_sys is not part of the systematics vector, handle it independently
+    {
+      SYM_PROFILE_SCOPE(profiler, SYSTEMATICS);
+      if(host_lineage_sys && GetUpdate() % my_config->PHYLOGENY_PRUNE_INT() == 0){
+        host_lineage_sys->Prune();
+        sym_lineage_sys->Prune();
+      }
+      if(sym_sys) sym_sys->Update(); //sym_sys is not part of the systematics vector, handle it independently
+    }
+    //symbiont deaths during the update are applied to the systematic together at its end
+    in_update = my_config->PHYLOGENY();
     emp::vector<size_t> schedule = emp::GetPermutation(GetRandom(), GetSize());
     // divvy up and distribute resources to host and symbiont in each cell
     for (size_t i : schedule) {
       if (!IsOccupied(i) && !sym_pop[i]){ continue;} // no organism at that cell
       if(IsOccupied(i)){//can't call GetDead on a deleted sym, so
+        SYM_PROFILE_SCOPE(profiler, HOST_PROCESS);
         pop[i]->Process(i);
         if (pop[i]->GetDead()) { //Check if the host died
           DoDeath(i);
         }
       }
       if(sym_pop[i]){ //for sym movement reasons, syms are deleted the update after they are set to dead
+        SYM_PROFILE_SCOPE(profiler, SYM_PROCESS);
         emp::WorldPosition sym_pos = emp::WorldPosition(0,i);
         if (sym_pop[i]->GetDead()) DoSymDeath(i); //Might have died since their last time being processed
         else sym_pop[i]->Process(sym_pos); //index 0, since it's freeliving, and id its location in the world
       }
     } // for each cell in schedule
+
+    if(in_update){
+      SYM_PROFILE_SCOPE(profiler, SYSTEMATICS);
+      ApplySymRemovals();
+      in_update = false;
+    }
   } // Update()
 };// SymWorld class
 #endif
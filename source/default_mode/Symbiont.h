@@ -4,12 +4,18 @@
 #include "../../Empirical/include/emp/math/Random.hpp"
 #include "../../Empirical/include/emp/tools/string_utils.hpp"
 #include "SymWorld.h"
+#include "ObjectCensus.h"
+#include "SymContext.h"
+#include "ResourceKernel.h"
+#include "TraitValue.h"
 #include <set>
 #include <iomanip> // setprecision
 #include <sstream> // stringstream
+#include <type_traits>
+#include <typeinfo>
 
 
-class Symbiont: public Organism {
+class Symbiont: public Organism, public CensusCounter<Symbiont> {
 protected:
   /**
     *
@@ -18,7 +24,15 @@ protected:
     * one represents mutualism. Zero is a neutral value.
     *
   */
-  double interaction_val = 0;
+  TraitValue interaction_val = 0;
+
+  /**
+    *
+    * Purpose: Represents the chance (between 0 and 1) that
+    * a free-living sym will infect a parallel host on process
+    *
+  */
+  TraitValue infection_chance = 0.0;
 
   /**
     *
@@ -38,33 +52,36 @@ protected:
 
   /**
     *
-    * Purpose: Represents the chance (between 0 and 1) that
-    * a free-living sym will infect a parallel host on process
+    * Purpose: Represents if the symbiont's share of its host's resources is
+    * computed with ResourceKernel: 1 if it is, 0 if not and -1 until
+    * HasDefaultResourceProcessing is first called.
     *
   */
-  double infection_chance = 0.0;
+  int8_t kernel_processing = -1;
 
   /**
     *
-    * Purpose: Represents the number of updates the symbiont
-    * has lived through; at birth is set to 0.
+    * Purpose: Represents if the symbiont is counted in its world's genotype
+    * table. It sits beside dead, so it adds nothing to the symbiont's size.
     *
   */
-  int age = 0;
+  bool in_genotypes = false;
 
   /**
     *
-    * Purpose: Represents an instance of random.
+    * Purpose: Represents the number of updates the symbiont
+    * has lived through; at birth is set to 0.
     *
   */
-  emp::Ptr<emp::Random> random = NULL;
+  int age = 0;
 
   /**
     *
-    * Purpose: Represents the world that the hosts are living in.
+    * Purpose: Represents the random number generator, world and configuration
+    * settings, owned by the world and shared with its other organisms.
     *
   */
-  emp::Ptr<SymWorld> my_world = NULL;
+  emp::Ptr<SymContext> context = nullptr;
 
   /**
     *
@@ -75,26 +92,30 @@ protected:
 
   /**
     *
-    * Purpose: Represents the configuration settings for a particular run.
+    * Purpose: Tracks the taxon of this organism.
     *
   */
-  emp::Ptr<SymConfigBase> my_config = NULL;
+  emp::Ptr<emp::Taxon<int>> my_taxon = NULL;
 
   /**
     *
-    * Purpose: Tracks the taxon of this organism.
+    * Purpose: Tracks the entry of this organism in the world's lightweight
+    * phylogeny tracker, when PHYLOGENY_TRACKER is not full.
     *
   */
-  emp::Ptr<emp::Taxon<int>> my_taxon = NULL;
+  size_t phylo_id = 0;
+
 
 public:
   /**
    * The constructor for symbiont
    */
-  Symbiont(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) :  interaction_val(_intval), points(_points), random(_random), my_world(_world), my_config(_config) {
-    infection_chance = my_config->SYM_INFECTION_CHANCE();
-    if (infection_chance == -2) infection_chance = random->GetDouble(0,1); //randomized starting infection chance
-    if (infection_chance > 1 || infection_chance < 0) throw "Invalid infection chance. Must be between 0 and 1"; //exception for invalid infection chance
+  Symbiont(emp::Ptr<emp::Random> _random, emp::Ptr<SymWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) :  interaction_val(_intval), points(_points), context(_world->GetContext(_random, _config)) {
+    //check the setting as a double, since traits may be stored with less precision
+    double start_infection_chance = context->config->SYM_INFECTION_CHANCE();
+    if (start_infection_chance == -2) start_infection_chance = context->random->GetDouble(0,1); //randomized starting infection chance
+    if (start_infection_chance > 1 || start_infection_chance < 0) throw "Invalid infection chance. Must be between 0 and 1"; //exception for invalid infection chance
+    infection_chance = start_infection_chance;
 
     if ( _intval > 1 || _intval < -1) {
        throw "Invalid interaction value. Must be between -1 and 1";   // Exception for invalid interaction value
@@ -159,7 +180,11 @@ public:
    * Purpose: To destruct the symbiont and remove the symbiont from the systematic.
    */
   ~Symbiont() {
-    if(my_config->PHYLOGENY() == 1) {my_world->GetSymSys()->RemoveOrg(my_taxon, my_world->GetUpdate());}
+    if(context->config->PHYLOGENY() == 1) {
+      if (my_taxon) context->world->IndexSym(my_taxon, my_host, -1);
+      context->world->RemoveSymFromSystematic(my_taxon, phylo_id);
+    }
+    if (in_genotypes) context->world->RemoveFromGenotypes(this);
   }
 
     /**
@@ -174,6 +199,35 @@ public:
     }
 
 
+    /**
+    * Input: The StateHasher building the digest.
+    * 
+    * Output: None
+    *
+    * Purpose: To add the symbiont's state to a digest of the world.
+    */
+    void AddToDigest(StateHasher & hasher) {
+      hasher.Add((double) interaction_val);
+      hasher.Add(points);
+      hasher.Add(dead);
+      hasher.Add((double) infection_chance);
+      hasher.Add(age);
+    }
+
+
+    /**
+    * Input: The genotype being built.
+    *
+    * Output: None
+    *
+    * Purpose: To add the symbiont's traits to its genotype.
+    */
+    void AddToGenotype(Genotype & _genotype) {
+      _genotype.int_val = interaction_val;
+      _genotype.infection_chance = infection_chance;
+    }
+
+
   /**
    * Input: None
    *
@@ -253,6 +307,23 @@ public:
     */
    void SetTaxon(emp::Ptr<emp::Taxon<int>> _in) {my_taxon = _in;}
 
+  /**
+   * Input: None
+   *
+   * Output: The symbiont's entry in the lightweight phylogeny tracker
+   *
+   * Purpose: To retrieve the symbiont's phylogeny entry
+   */
+   size_t GetPhyloID() {return phylo_id;}
+
+   /**
+    * Input: The entry in the lightweight phylogeny tracker this organism belongs to.
+    *
+    * Output: None
+    *
+    * Purpose: To set the symbiont's phylogeny entry
+    */
+   void SetPhyloID(size_t _in) {phylo_id = _in;}
   //  std::set<int> GetResTypes() const {return res_types;}
 
 
@@ -266,6 +337,26 @@ public:
   void SetDead() { dead = true; }
 
 
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the symbiont is counted in the genotype table.
+   *
+   * Purpose: To know if the symbiont must be removed from the genotype table.
+   */
+  bool IsInGenotypes() { return in_genotypes; }
+
+
+  /**
+   * Input: The bool representing if the symbiont is counted in the genotype table.
+   *
+   * Output: None
+   *
+   * Purpose: To record when the symbiont is added to or removed from the genotype table.
+   */
+  void SetInGenotypes(bool _in) { in_genotypes = _in; }
+
+
   /**
    * Input: None
    *
@@ -336,7 +427,12 @@ public:
    *
    * Purpose: To set a symbiont's host
    */
-  void SetHost(emp::Ptr<Organism> _in) {my_host = _in;}
+  void SetHost(emp::Ptr<Organism> _in) {
+    //keep the world's count of free-living and hosted symbionts of each taxon current
+    if (my_taxon) context->world->IndexSymLocation(my_taxon, my_host, -1);
+    my_host = _in;
+    if (my_taxon) context->world->IndexSymLocation(my_taxon, my_host, 1);
+  }
 
   /**
    * Input: The double that will be the symbiont's infection chance
@@ -373,7 +469,7 @@ public:
    */
   void GrowOlder(){
     age = age + 1;
-    if(age > my_config->SYM_AGE_MAX() && my_config->SYM_AGE_MAX() > 0){
+    if(age > context->config->SYM_AGE_MAX() && context->config->SYM_AGE_MAX() > 0){
       SetDead();
     }
   }
@@ -389,23 +485,69 @@ public:
    * deviation.
    */
   void Mutate(){
-    double local_rate = my_config->MUTATION_RATE();
-    double local_size = my_config->MUTATION_SIZE();
+    double local_rate = context->config->MUTATION_RATE();
+    double local_size = context->config->MUTATION_SIZE();
 
-    if (random->GetDouble(0.0, 1.0) <= local_rate) {
-      interaction_val += random->GetRandNormal(0.0, local_size);
+    if (context->random->GetDouble(0.0, 1.0) <= local_rate) {
+      interaction_val += context->random->GetRandNormal(0.0, local_size);
       if(interaction_val < -1) interaction_val = -1;
       else if (interaction_val > 1) interaction_val = 1;
 
       //also modify infection chance, which is between 0 and 1
-      if(my_config->FREE_LIVING_SYMS()){
-        infection_chance += random->GetRandNormal(0.0, local_size);
+      if(context->config->FREE_LIVING_SYMS()){
+        infection_chance += context->random->GetRandNormal(0.0, local_size);
         if (infection_chance < 0) infection_chance = 0;
         else if (infection_chance > 1) infection_chance = 1;
       }
     }
   }
 
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the symbiont processes resources with
+   * the ProcessResources defined here.
+   *
+   * Purpose: To let hosts compute this symbiont's share with ResourceKernel
+   * instead of calling ProcessResources. Only symbionts that are exactly
+   * Symbiont use it; a subclass that keeps ProcessResources can opt in by
+   * declaring this as InheritsProcessResources<its class>().
+   */
+  bool HasDefaultResourceProcessing() {return InheritsProcessResources<Symbiont>();}
+
+  /**
+   * Input: The class declaring HasDefaultResourceProcessing, as the template
+   * argument.
+   *
+   * Output: The bool representing if this symbiont is exactly that class and
+   * the class does not override ProcessResources.
+   *
+   * Purpose: To derive HasDefaultResourceProcessing from the class, so that a
+   * subclass that overrides ProcessResources, or does not opt in, always goes
+   * through ProcessResources. The answer is found once per symbiont.
+   */
+  template <typename SYM_T>
+  bool InheritsProcessResources() {
+    if (kernel_processing < 0) {
+      kernel_processing = typeid(*this) == typeid(SYM_T) &&
+        std::is_same<decltype(&SYM_T::ProcessResources), decltype(&Symbiont::ProcessResources)>::value;
+    }
+    return kernel_processing;
+  }
+
+  /**
+   * Input: The interaction value of the host; the resources given to this
+   * symbiont; the SYNERGY multiplier; where to put the points the host and
+   * this symbiont gain.
+   *
+   * Output: None
+   *
+   * Purpose: To get the points from ResourceKernel::DistribPair.
+   */
+  void GetPayoff(double host_int_val, double sym_piece, double synergy, double & host_gain, double & sym_gain) {
+    ResourceKernel::DistribPair(host_int_val, interaction_val, sym_piece, synergy, host_gain, sym_gain);
+  }
+
   /**
    * Input: The double representing the resources to be distributed to the symbiont
    * and (optionally) the host from whom it comes; if no host is provided, the
@@ -422,7 +564,7 @@ public:
     double sym_int_val = GetIntVal();
     double sym_portion = 0;
     double host_portion = 0;
-    double synergy = my_config->SYNERGY();
+    double synergy = context->config->SYNERGY();
 
     if (sym_int_val<0){
       double stolen = host->StealResources(sym_int_val);
@@ -448,7 +590,7 @@ public:
    * infect a host based upon its infection chance
    */
   bool WantsToInfect(){
-    bool result = random->GetDouble(0.0, 1.0) < infection_chance;
+    bool result = context->random->GetDouble(0.0, 1.0) < infection_chance;
     return result;
   }
 
@@ -464,7 +606,7 @@ public:
    */
   bool InfectionFails(){
     //note: this can be returned true, and an infecting sym can then be killed by a host that is already infected.
-    bool sym_dies = random->GetDouble(0.0, 1.0) < my_config->SYM_INFECTION_FAILURE_RATE();
+    bool sym_dies = context->random->GetDouble(0.0, 1.0) < context->config->SYM_INFECTION_FAILURE_RATE();
     return sym_dies;
   }
 
@@ -503,8 +645,8 @@ public:
    //size_t rank=-1
   void Process(emp::WorldPosition location) {
     //ID is where they are in the world, INDEX is where they are in the host's symbiont list (or 0 if they're free living)
-    if (my_host.IsNull() && my_config->FREE_LIVING_SYMS()) { //free living symbiont
-      double resources = my_world->PullResources(my_config->FREE_SYM_RES_DISTRIBUTE()); //receive resources from the world
+    if (my_host.IsNull() && context->config->FREE_LIVING_SYMS()) { //free living symbiont
+      double resources = context->world->PullResources(context->config->FREE_SYM_RES_DISTRIBUTE()); //receive resources from the world
       LoseResources(resources);
     }
     //Check if horizontal transmission can occur and do it
@@ -512,9 +654,9 @@ public:
     //Age the organism
     GrowOlder();
     //Check if the organism should move and do it
-    if (my_host.IsNull() && my_config->FREE_LIVING_SYMS() && !dead) {
+    if (my_host.IsNull() && context->config->FREE_LIVING_SYMS() && !dead) {
       //if the symbiont should move, and hasn't been killed
-      my_world->MoveFreeSym(location);
+      context->world->MoveFreeSym(location);
     }
   }
 
@@ -526,7 +668,7 @@ public:
    * Purpose: To produce a new symbiont, identical to the original
    */
   emp::Ptr<Organism> MakeNew() {
-    emp::Ptr<Symbiont> new_sym = emp::NewPtr<Symbiont>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Symbiont> new_sym = emp::NewPtr<Symbiont>(context->random, context->world, context->config, GetIntVal());
     new_sym->SetInfectionChance(GetInfectionChance());
     return new_sym;
   }
@@ -542,10 +684,11 @@ public:
     emp::Ptr<Organism> sym_baby = MakeNew();
     sym_baby->Mutate();
 
-    if(my_config->PHYLOGENY() == 1){
-      my_world->AddSymToSystematic(sym_baby, my_taxon);
+    if(context->config->PHYLOGENY() == 1){
+      context->world->AddSymToSystematic(sym_baby, my_taxon, this);
       //baby's taxon will be set in AddSymToSystematic
     }
+    context->world->AddToGenotypes(sym_baby);
     return sym_baby;
   }
 
@@ -557,13 +700,13 @@ public:
    * Purpose: To allow for vertical transmission to occur
    */
   void VerticalTransmission(emp::Ptr<Organism> host_baby) {
-    if((my_world->WillTransmit()) && GetPoints() >= my_config->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
+    if((context->world->WillTransmit()) && GetPoints() >= context->config->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
       emp::Ptr<Organism> sym_baby = Reproduce();
-      points = points - my_config->SYM_VERT_TRANS_RES();
+      points = points - context->config->SYM_VERT_TRANS_RES();
       host_baby->AddSymbiont(sym_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      emp::DataMonitor<int>& data_node_attempts_verttrans = context->world->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -576,20 +719,20 @@ public:
    * Purpose: To check and allow for horizontal transmission to occur
    */
   void HorizontalTransmission(emp::WorldPosition location) {
-    if (my_config->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
-      if(GetPoints() >= my_config->SYM_HORIZ_TRANS_RES()) {
+    if (context->config->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
+      if(GetPoints() >= context->config->SYM_HORIZ_TRANS_RES()) {
         // symbiont reproduces independently (horizontal transmission) if it has enough resources
         //TODO: try just subtracting points to be consistent with vertical transmission
-        //points = points - my_config->SYM_HORIZ_TRANS_RES();
+        //points = points - context->config->SYM_HORIZ_TRANS_RES();
         SetPoints(0);
         emp::Ptr<Organism> sym_baby = Reproduce();
-        emp::WorldPosition new_pos = my_world->SymDoBirth(sym_baby, location);
+        emp::WorldPosition new_pos = context->world->SymDoBirth(sym_baby, location);
 
         //horizontal transmission data nodes
-        emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+        emp::DataMonitor<int>& data_node_attempts_horiztrans = context->world->GetHorizontalTransmissionAttemptCount();
         data_node_attempts_horiztrans.AddDatum(1);
 
-        emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+        emp::DataMonitor<int>& data_node_successes_horiztrans = context->world->GetHorizontalTransmissionSuccessCount();
         if(new_pos.IsValid()){
           data_node_successes_horiztrans.AddDatum(1);
         }
@@ -0,0 +1,84 @@
+#ifndef TRAIT_VALUE_H
+#define TRAIT_VALUE_H
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * A trait bounded in [-1, 1] stored in 16 bits: the value times SCALE,
+ * rounded to the nearest integer. Values are quantized to steps of 1/SCALE
+ * (about 3.05e-5), so a stored value is within half a step (about 1.53e-5)
+ * of the value assigned to it. Values outside [-1, 1] are clamped.
+ *
+ * It converts to and from double, so traits are read and assigned the same
+ * way as when they are stored as doubles.
+ */
+class FixedTrait16 {
+  int16_t stored = 0;
+
+public:
+  static constexpr double SCALE = 32767;
+
+  FixedTrait16() = default;
+  FixedTrait16(double val) { *this = val; }
+
+  /**
+   * Input: The new value.
+   *
+   * Output: This trait.
+   *
+   * Purpose: To store a value, rounded to the nearest step.
+   */
+  FixedTrait16 & operator=(double val) {
+    //owners clamp their traits too, this only keeps rounding from overflowing
+    if (val > 1) val = 1;
+    else if (val < -1) val = -1;
+    stored = (int16_t) std::lround(val * SCALE);
+    return *this;
+  }
+
+  FixedTrait16 & operator+=(double val) { return *this = (double) *this + val; }
+
+  operator double() const { return stored / SCALE; }
+};
+
+/**
+ * The type interaction values, infection, lysis and induction chances,
+ * incorporation values, PGG donations and efficiencies are stored as.
+ * Building with -DSYMBULATION_TRAIT_BITS=32 stores them as floats and
+ * -DSYMBULATION_TRAIT_BITS=16 as FixedTrait16; otherwise they are doubles.
+ * Calculations with traits are always done in double.
+ */
+#if SYMBULATION_TRAIT_BITS == 16
+using TraitValue = FixedTrait16;
+#elif SYMBULATION_TRAIT_BITS == 32
+using TraitValue = float;
+#else
+using TraitValue = double;
+#endif
+
+/**
+ * The most a stored trait in [-1, 1] can differ from the value assigned to
+ * it: half a step with FixedTrait16, half a float step below 1 with floats,
+ * and nothing with doubles.
+ */
+#if SYMBULATION_TRAIT_BITS == 16
+constexpr double TRAIT_ROUNDING = 0.5 / FixedTrait16::SCALE;
+#elif SYMBULATION_TRAIT_BITS == 32
+constexpr double TRAIT_ROUNDING = 1.0 / (1 << 25);
+#else
+constexpr double TRAIT_ROUNDING = 0;
+#endif
+
+
+/**
+ * Input: A value.
+ *
+ * Output: The value a trait holds once it is assigned that value.
+ *
+ * Purpose: To compare traits with the values they were set to in every
+ * build, since a reduced precision trait holds the nearest value it can store.
+ */
+inline double StoredTrait(double val) { return (double) TraitValue(val); }
+
+#endif
@@ -4,7 +4,7 @@
 #include "../default_mode/Host.h"
 #include "EfficientWorld.h"
 
-class EfficientHost: public Host {
+class EfficientHost: public Host, public CensusCounter<EfficientHost> {
 protected:
 
   /**
@@ -12,14 +12,16 @@ protected:
     * Purpose: Represents the efficiency of a host.
     *
   */
-  double efficiency;
+  TraitValue efficiency;
 
   /**
-    *
-    * Purpose: Represents the world that the efficient hosts are living in.
-    *
-  */
-  emp::Ptr<EfficientWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The world that the efficient hosts are living in.
+   *
+   * Purpose: To reach the EfficientWorld through the context shared with the other organisms.
+   */
+  emp::Ptr<EfficientWorld> GetWorld() { return context->world.Cast<EfficientWorld>(); }
 public:
   /**
    * The constructor for efficient host
@@ -30,7 +32,6 @@ public:
   double _points = 0.0, double _efficient = 0.1) :
   Host(_random, _world, _config, _intval, _syms, _repro_syms, _points) {
     efficiency = _efficient;
-    my_world = _world;
   }
 
 
@@ -74,6 +75,31 @@ public:
     return  "EfficientHost";
   }
 
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the efficient host's state to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    Host::AddToDigest(hasher);
+    hasher.Add((double) efficiency);
+  }
+
+  /**
+  * Input: The genotype being built.
+  *
+  * Output: None
+  *
+  * Purpose: To add the efficient host's traits to its genotype.
+  */
+  void AddToGenotype(Genotype & _genotype) {
+    Host::AddToGenotype(_genotype);
+    _genotype.efficiency = efficiency;
+  }
+
   /**
    * Input: Efficiency value
    *
@@ -103,7 +129,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<EfficientHost> host_baby = emp::NewPtr<EfficientHost>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<EfficientHost> host_baby = emp::NewPtr<EfficientHost>(context->random, GetWorld(), context->config, GetIntVal());
     host_baby->SetEfficiency(GetEfficiency());
     return host_baby;
   }
@@ -7,7 +7,7 @@
 
 
 
-class EfficientSymbiont: public Symbiont {
+class EfficientSymbiont: public Symbiont, public CensusCounter<EfficientSymbiont> {
 protected:
 
   /**
@@ -16,56 +16,22 @@ protected:
     * symbiont's resource collection.
     *
   */
-  double efficiency;
+  TraitValue efficiency;
 
   /**
-    *
-    * Purpose: Represents the standard deviation of the values
-    * chosen as mutations of a symbiont's interaction value when
-    * horizontal transmission is occuring. .
-    *
-  */
-  double ht_mut_size = 0.002;
-
-  /**
-    *
-    * Purpose: Represents the probability (0-1) of mutation occurring
-    * during horizontal transmission.
-    *
-  */
-  double ht_mut_rate = 0;
-
-  /**
-    *
-    * Purpose: Represents the probability (0-1) of mutation occurring
-    * during horizontal transmission for the efficiency trait.
-    *
-  */
-  double eff_mut_rate = 0;
-
-  /**
-    *
-    * Purpose: Represents the world that the efficient symbionts are living in.
-    *
-  */
-  emp::Ptr<EfficientWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The world that the efficient symbionts are living in.
+   *
+   * Purpose: To reach the EfficientWorld through the context shared with the other organisms.
+   */
+  emp::Ptr<EfficientWorld> GetWorld() { return context->world.Cast<EfficientWorld>(); }
 public:
   /**
    * The constructor for efficient symbiont
    */
   EfficientSymbiont(emp::Ptr<emp::Random> _random, emp::Ptr<EfficientWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0, double _efficient = 0.1) : Symbiont(_random, _world, _config, _intval, _points) {
     efficiency = _efficient;
-    my_world = _world;
-    if(my_config->HORIZ_MUTATION_RATE() < 0){
-      ht_mut_rate = my_config->MUTATION_RATE();
-    } else {
-      ht_mut_rate = my_config->HORIZ_MUTATION_RATE();
-    }
-    if(my_config->HORIZ_MUTATION_SIZE() < 0) {
-      ht_mut_size = my_config->MUTATION_SIZE();
-    } else {
-      ht_mut_size = my_config->HORIZ_MUTATION_SIZE();
-    }
   }
 
 
@@ -109,6 +75,42 @@ public:
     return  "EfficientSymbiont";
   }
 
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the symbiont processes resources with
+   * Symbiont::ProcessResources, which EfficientSymbionts do.
+   *
+   * Purpose: To let hosts compute this symbiont's share with ResourceKernel.
+   */
+  bool HasDefaultResourceProcessing() {return InheritsProcessResources<EfficientSymbiont>();}
+
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the efficient symbiont's state to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    Symbiont::AddToDigest(hasher);
+    hasher.Add((double) efficiency);
+  }
+
+  /**
+  * Input: The genotype being built.
+  *
+  * Output: None
+  *
+  * Purpose: To add the efficient symbiont's traits to its genotype.
+  */
+  void AddToGenotype(Genotype & _genotype) {
+    Symbiont::AddToGenotype(_genotype);
+    _genotype.efficiency = efficiency;
+  }
+
   /**
    * Input: Efficiency value
    *
@@ -156,43 +158,47 @@ public:
     double local_size;
     double local_rate;
     double int_rate;
+    double eff_mut_rate;
 
     if(mode == "vertical"){
-      local_rate = my_config->MUTATION_RATE();
-      local_size = my_config->MUTATION_SIZE();
+      local_rate = context->config->MUTATION_RATE();
+      local_size = context->config->MUTATION_SIZE();
     } else if(mode == "horizontal") {
-      local_rate = ht_mut_rate;
-      local_size = ht_mut_size;
+      //horizontal transmission uses the general mutation settings unless it has its own
+      local_rate = context->config->HORIZ_MUTATION_RATE();
+      if(local_rate < 0) local_rate = context->config->MUTATION_RATE();
+      local_size = context->config->HORIZ_MUTATION_SIZE();
+      if(local_size < 0) local_size = context->config->MUTATION_SIZE();
     } else {
       throw "Illegal argument passed to mutate in EfficientSymbiont";
     }
 
-    if(my_config->EFFICIENCY_MUT_RATE() >= 0) {
-      eff_mut_rate = my_config->EFFICIENCY_MUT_RATE();
+    if(context->config->EFFICIENCY_MUT_RATE() >= 0) {
+      eff_mut_rate = context->config->EFFICIENCY_MUT_RATE();
     } else {
       eff_mut_rate = local_rate;
     }
 
-    if(my_config->INT_VAL_MUT_RATE() >= 0) {
-      int_rate = my_config->INT_VAL_MUT_RATE();
+    if(context->config->INT_VAL_MUT_RATE() >= 0) {
+      int_rate = context->config->INT_VAL_MUT_RATE();
     } else {
       int_rate = local_rate;
     }
 
-    if (random->GetDouble(0.0, 1.0) <= int_rate) {
-      interaction_val += random->GetRandNormal(0.0, local_size);
+    if (context->random->GetDouble(0.0, 1.0) <= int_rate) {
+      interaction_val += context->random->GetRandNormal(0.0, local_size);
       if(interaction_val < -1) interaction_val = -1;
       else if (interaction_val > 1) interaction_val = 1;
 
       //also modify infection chance, which is between 0 and 1
-      if(my_config->FREE_LIVING_SYMS()){
-        infection_chance += random->GetRandNormal(0.0, local_size);
+      if(context->config->FREE_LIVING_SYMS()){
+        infection_chance += context->random->GetRandNormal(0.0, local_size);
         if (infection_chance < 0) infection_chance = 0;
         else if (infection_chance > 1) infection_chance = 1;
       }
     }
-    if (random->GetDouble(0.0, 1.0) <= eff_mut_rate) {
-      efficiency += random->GetRandNormal(0.0, local_size);
+    if (context->random->GetDouble(0.0, 1.0) <= eff_mut_rate) {
+      efficiency += context->random->GetRandNormal(0.0, local_size);
       if(efficiency < 0) efficiency = 0;
       else if (efficiency > 1) efficiency = 1;
     }
@@ -209,7 +215,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<EfficientSymbiont> sym_baby = emp::NewPtr<EfficientSymbiont>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<EfficientSymbiont> sym_baby = emp::NewPtr<EfficientSymbiont>(context->random, GetWorld(), context->config, GetIntVal());
     sym_baby->SetInfectionChance(GetInfectionChance());
     sym_baby->SetEfficiency(GetEfficiency());
     return sym_baby;
@@ -227,6 +233,7 @@ public:
   emp::Ptr<Organism> Reproduce(std::string mode) {
     emp::Ptr<Organism> sym_baby = MakeNew();
     sym_baby->Mutate(mode);
+    context->world->AddToGenotypes(sym_baby);
     return sym_baby;
   }
   #pragma clang diagnostic pop
@@ -240,12 +247,12 @@ public:
    * Purpose: To allow for vertical transmission to occur
    */
   void VerticalTransmission(emp::Ptr<Organism> host_baby) {
-    if((my_world->WillTransmit()) && GetPoints() >= my_config->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
+    if((GetWorld()->WillTransmit()) && GetPoints() >= context->config->SYM_VERT_TRANS_RES()){ //if the world permits vertical tranmission and the sym has enough resources, transmit!
       emp::Ptr<Organism> sym_baby = Reproduce("vertical");
       host_baby->AddSymbiont(sym_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      emp::DataMonitor<int>& data_node_attempts_verttrans = GetWorld()->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -258,19 +265,19 @@ public:
    * Purpose: To check and allow for horizontal transmission to occur
    */
   void HorizontalTransmission(emp::WorldPosition location) {
-    if (my_config->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
-      if(GetPoints() >= my_config->SYM_HORIZ_TRANS_RES()) {
+    if (context->config->HORIZ_TRANS()) { //non-lytic horizontal transmission enabled
+      if(GetPoints() >= context->config->SYM_HORIZ_TRANS_RES()) {
         // symbiont reproduces independently (horizontal transmission) if it has enough resources
         // new symbiont in this host with mutated value
         SetPoints(0); //TODO: test just subtracting points instead of setting to 0
         emp::Ptr<Organism> sym_baby = Reproduce("horizontal");
-        emp::WorldPosition new_pos = my_world->SymDoBirth(sym_baby, location);
+        emp::WorldPosition new_pos = GetWorld()->SymDoBirth(sym_baby, location);
 
         //horizontal transmission data nodes
-        emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
+        emp::DataMonitor<int>& data_node_attempts_horiztrans = GetWorld()->GetHorizontalTransmissionAttemptCount();
         data_node_attempts_horiztrans.AddDatum(1);
 
-        emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+        emp::DataMonitor<int>& data_node_successes_horiztrans = GetWorld()->GetHorizontalTransmissionSuccessCount();
         if(new_pos.IsValid()){
           data_node_successes_horiztrans.AddDatum(1);
         }
@@ -4,6 +4,9 @@
 #include "../default_mode/SymWorld.h"
 #include "../default_mode/DataNodes.h"
 
+class EfficientHost;
+class EfficientSymbiont;
+
 class EfficientWorld : public SymWorld {
 private:
   /**
@@ -36,7 +39,22 @@ public:
   void CreateDateFiles(){
     std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
     SymWorld::CreateDateFiles();
-    SetupEfficiencyFile(my_config->FILE_PATH()+"Efficiency"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
+    if(IsDataEnabled("Efficiency")){
+      SetupEfficiencyFile(my_config->FILE_PATH()+"Efficiency"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+    }
+  }
+
+  /**
+   * Input: The SymDataFile object tracking the census.
+   *
+   * Output: None.
+   *
+   * Purpose: To add EfficientHost and EfficientSymbiont objects to the census.
+   */
+  void SetupCensusColumns(SymDataFile & file){
+    SymWorld::SetupCensusColumns(file);
+    AddCensusColumns<EfficientHost>(file, "efficient_host");
+    AddCensusColumns<EfficientSymbiont>(file, "efficient_sym");
   }
 
   /**
@@ -49,9 +67,10 @@ public:
    */
   emp::DataFile & SetupEfficiencyFile(const std::string & filename) {
     auto & file = SetupFile(filename);
-    auto & node = GetEfficiencyDataNode();
     file.AddVar(update, "update", "Update");
-    file.AddMean(node, "mean_efficiency", "Average efficiency", true);
+    if(IsDataEnabled("Efficiency", "mean_efficiency")){
+      file.AddMean(GetEfficiencyDataNode(), "mean_efficiency", "Average efficiency", true);
+    }
     file.PrintHeaderKeys();
 
     return file;
@@ -73,7 +92,7 @@ public:
         data_node_efficiency->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+            SymList& syms = pop[i]->GetSymbionts();
             size_t sym_size = syms.size();
             for(size_t j=0; j< sym_size; j++){
               data_node_efficiency->AddDatum(syms[j]->GetEfficiency());
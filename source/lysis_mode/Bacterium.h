@@ -5,7 +5,7 @@
 #include "LysisWorld.h"
 
 
-class Bacterium : public Host {
+class Bacterium : public Host, public CensusCounter<Bacterium> {
 
 
 protected:
@@ -17,14 +17,16 @@ protected:
     *
     *
   */
-  double host_incorporation_val = 0;
+  TraitValue host_incorporation_val = 0;
 
   /**
-    *
-    * Purpose: Represents the world that the hosts are living in.
-    *
-  */
-  emp::Ptr<LysisWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The world that the bacteria are living in.
+   *
+   * Purpose: To reach the LysisWorld through the context shared with the other organisms.
+   */
+  emp::Ptr<LysisWorld> GetWorld() { return context->world.Cast<LysisWorld>(); }
 
 public:
 
@@ -35,11 +37,12 @@ public:
   double _intval =0.0, emp::vector<emp::Ptr<Organism>> _syms = {},
   emp::vector<emp::Ptr<Organism>> _repro_syms = {},
   double _points = 0.0) : Host(_random, _world, _config, _intval,_syms, _repro_syms, _points)  {
-    host_incorporation_val = my_config->HOST_INC_VAL();
-    if(host_incorporation_val == -1){
-      host_incorporation_val = random->GetDouble(0.0, 1.0);
+    //check the setting as a double, since traits may be stored with less precision
+    double start_incorporation_val = context->config->HOST_INC_VAL();
+    if(start_incorporation_val == -1){
+      start_incorporation_val = context->random->GetDouble(0.0, 1.0);
     }
-    my_world = _world;
+    host_incorporation_val = start_incorporation_val;
   }
 
   /**
@@ -82,6 +85,31 @@ public:
     return  "Bacterium";
   }
 
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the bacterium's state to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    Host::AddToDigest(hasher);
+    hasher.Add((double) host_incorporation_val);
+  }
+
+  /**
+  * Input: The genotype being built.
+  *
+  * Output: None
+  *
+  * Purpose: To add the bacterium's traits to its genotype.
+  */
+  void AddToGenotype(Genotype & _genotype) {
+    Host::AddToGenotype(_genotype);
+    _genotype.inc_val = host_incorporation_val;
+  }
+
   /**
    * Input: None
    *
@@ -109,7 +137,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<Bacterium> host_baby = emp::NewPtr<Bacterium>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Bacterium> host_baby = emp::NewPtr<Bacterium>(context->random, GetWorld(), context->config, GetIntVal());
     host_baby->SetIncVal(GetIncVal());
     return host_baby;
   }
@@ -126,11 +154,11 @@ public:
   void Mutate() {
     Host::Mutate();
 
-    if(random->GetDouble(0.0, 1.0) <= my_config->MUTATION_RATE()){
+    if(context->random->GetDouble(0.0, 1.0) <= context->config->MUTATION_RATE()){
 
       //mutate host genome if enabled
-      if(my_config->MUTATE_INC_VAL()){
-        host_incorporation_val += random->GetRandNormal(0.0, my_config->MUTATION_SIZE());
+      if(context->config->MUTATE_INC_VAL()){
+        host_incorporation_val += context->random->GetRandNormal(0.0, context->config->MUTATION_SIZE());
 
         if(host_incorporation_val < 0) host_incorporation_val = 0;
 
@@ -141,7 +169,7 @@ public:
 
   double ProcessLysogenResources(double phage_inc_val){
     double incorporation_success = 1 - abs(GetIncVal() - phage_inc_val);
-    double processed_resources = GetResInProcess() * incorporation_success * my_config->SYNERGY();
+    double processed_resources = GetResInProcess() * incorporation_success * context->config->SYNERGY();
     SetResInProcess(0);
     return processed_resources;
   }
@@ -4,6 +4,9 @@
 #include "../default_mode/SymWorld.h"
 #include "../default_mode/DataNodes.h"
 
+class Bacterium;
+class Phage;
+
 class LysisWorld : public SymWorld {
 private:
   /**
@@ -47,22 +50,42 @@ public:
   void CreateDateFiles(){
     std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
     SymWorld::CreateDateFiles();
-    SetupLysisChanceFile(my_config->FILE_PATH()+"LysisChance"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
-    SetupInductionChanceFile(my_config->FILE_PATH()+"InductionChance"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
-    SetupIncorporationDifferenceFile(my_config->FILE_PATH()+"IncValDifferences"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
+    if(IsDataEnabled("LysisChance")){
+      SetupLysisChanceFile(my_config->FILE_PATH()+"LysisChance"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+    }
+    if(IsDataEnabled("InductionChance")){
+      SetupInductionChanceFile(my_config->FILE_PATH()+"InductionChance"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+    }
+    if(IsDataEnabled("IncValDifferences")){
+      SetupIncorporationDifferenceFile(my_config->FILE_PATH()+"IncValDifferences"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+    }
   }
 
   /**
-   * Input: The Empirical DataFile object tracking data nodes.
+   * Input: The SymDataFile object tracking the census.
+   *
+   * Output: None.
+   *
+   * Purpose: To add Bacterium and Phage objects to the census.
+   */
+  void SetupCensusColumns(SymDataFile & file){
+    SymWorld::SetupCensusColumns(file);
+    AddCensusColumns<Bacterium>(file, "bacterium");
+    AddCensusColumns<Phage>(file, "phage");
+  }
+
+  /**
+   * Input: The SymDataFile object tracking data nodes.
    *
    * Output: None.
    *
    * Purpose: To add bacterium data nodes to be tracked to the bacterium data file.
    */
-  void SetupHostFileColumns(emp::DataFile & file){
+  void SetupHostFileColumns(SymDataFile & file){
     SymWorld::SetupHostFileColumns(file);
-    auto & cfu_node = GetCFUDataNode();
-    file.AddTotal(cfu_node, "cfu_count", "Total number of colony forming units"); //colony forming units are hosts that
+    if(IsDataEnabled("HostVals", "cfu_count")){
+      file.AddTotal(GetCFUDataNode(), "cfu_count", "Total number of colony forming units"); //colony forming units are hosts that
+    }
   }
 
   /**
@@ -77,25 +100,32 @@ public:
    */
   emp::DataFile & SetupLysisChanceFile(const std::string & filename) {
     auto & file = SetupFile(filename);
-    auto & node1 = GetSymCountDataNode();
-    auto & node = GetLysisChanceDataNode();
-    auto & node2 = GetBurstSizeDataNode();
-    auto & node3 = GetBurstCountDataNode();
     file.AddVar(update, "update", "Update");
-    file.AddTotal(node1, "count", "Total number of symbionts");
-    file.AddMean(node2, "mean_burstsize", "Average burst size", true);
-    file.AddTotal(node3, "burst_count", "Average burst count", true);
-    file.AddMean(node, "mean_lysischance", "Average chance of lysis");
-    file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-    file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-    file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-    file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-    file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-    file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-    file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-    file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-    file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-    file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+    if(IsDataEnabled("LysisChance", "count")){
+      file.AddTotal(GetSymCountDataNode(), "count", "Total number of symbionts");
+    }
+    if(IsDataEnabled("LysisChance", "mean_burstsize")){
+      file.AddMean(GetBurstSizeDataNode(), "mean_burstsize", "Average burst size", true);
+    }
+    if(IsDataEnabled("LysisChance", "burst_count")){
+      file.AddTotal(GetBurstCountDataNode(), "burst_count", "Average burst count", true);
+    }
+    if(IsDataEnabled("LysisChance", "mean_lysischance")){
+      file.AddMean(GetLysisChanceDataNode(), "mean_lysischance", "Average chance of lysis");
+    }
+    if(IsDataEnabled("LysisChance", "Hist")){
+      auto & node = GetLysisChanceDataNode();
+      file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+      file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+      file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+      file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+      file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+      file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+      file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+      file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+      file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+      file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+    }
 
     file.PrintHeaderKeys();
 
@@ -114,21 +144,26 @@ public:
     */
   emp::DataFile & SetupInductionChanceFile(const std::string & filename) {
      auto & file = SetupFile(filename);
-     auto & node1 = GetSymCountDataNode();
-     auto & node = GetInductionChanceDataNode();
      file.AddVar(update, "update", "Update");
-     file.AddMean(node, "mean_inductionchance", "Average chance of induction");
-     file.AddTotal(node1, "count", "Total number of symbionts");
-     file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-     file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-     file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-     file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-     file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-     file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-     file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-     file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-     file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-     file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+     if(IsDataEnabled("InductionChance", "mean_inductionchance")){
+       file.AddMean(GetInductionChanceDataNode(), "mean_inductionchance", "Average chance of induction");
+     }
+     if(IsDataEnabled("InductionChance", "count")){
+       file.AddTotal(GetSymCountDataNode(), "count", "Total number of symbionts");
+     }
+     if(IsDataEnabled("InductionChance", "Hist")){
+       auto & node = GetInductionChanceDataNode();
+       file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+       file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+       file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+       file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+       file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+       file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+       file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+       file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+       file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+       file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+     }
 
      file.PrintHeaderKeys();
 
@@ -147,19 +182,23 @@ public:
     */
      emp::DataFile & SetupIncorporationDifferenceFile(const std::string & filename) {
      auto & file = SetupFile(filename);
-     auto & node = GetIncorporationDifferenceDataNode();
      file.AddVar(update, "update", "Update");
-     file.AddMean(node, "mean_incval_difference", "Average difference in incorporation value between bacteria and their phage");
-     file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-     file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-     file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-     file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-     file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-     file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-     file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-     file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-     file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-     file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+     if(IsDataEnabled("IncValDifferences", "mean_incval_difference")){
+       file.AddMean(GetIncorporationDifferenceDataNode(), "mean_incval_difference", "Average difference in incorporation value between bacteria and their phage");
+     }
+     if(IsDataEnabled("IncValDifferences", "Hist")){
+       auto & node = GetIncorporationDifferenceDataNode();
+       file.AddHistBin(node, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+       file.AddHistBin(node, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+       file.AddHistBin(node, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+       file.AddHistBin(node, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+       file.AddHistBin(node, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+       file.AddHistBin(node, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+       file.AddHistBin(node, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+       file.AddHistBin(node, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+       file.AddHistBin(node, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+       file.AddHistBin(node, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+     }
 
      file.PrintHeaderKeys();
 
@@ -183,7 +222,7 @@ public:
         data_node_lysischance->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+            SymList& syms = pop[i]->GetSymbionts();
             long unsigned int sym_size = syms.size();
             for(size_t j=0; j< sym_size; j++){
               data_node_lysischance->AddDatum(syms[j]->GetLysisChance());
@@ -248,7 +287,7 @@ public:
         data_node_inductionchance->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) {
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+            SymList& syms = pop[i]->GetSymbionts();
             long unsigned int sym_size = syms.size();
             for(size_t j=0; j< sym_size; j++){
               data_node_inductionchance->AddDatum(syms[j]->GetInductionChance());
@@ -282,7 +321,7 @@ public:
           if (IsOccupied(i)) {
             double host_inc_val = pop[i]->GetIncVal();
 
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+            SymList& syms = pop[i]->GetSymbionts();
             long unsigned int sym_size = syms.size();
             for(size_t j=0; j< sym_size; j++){
               double inc_val_difference = abs(host_inc_val - syms[j]->GetIncVal());
@@ -321,7 +360,7 @@ public:
 
             //infected hosts, check if all symbionts are lysogenic
             if(pop[i]->HasSym()) {
-              emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+              SymList& syms = pop[i]->GetSymbionts();
               bool all_lysogenic = true;
               for(long unsigned int j = 0; j < syms.size(); j++){
                 if(syms[j]->IsPhage() && syms[j]->GetLysogeny() == false){
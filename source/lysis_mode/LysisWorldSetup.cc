@@ -13,7 +13,7 @@ void worldSetup(emp::Ptr<LysisWorld> world, emp::Ptr<SymConfigBase> my_config) {
   double start_moi = my_config->START_MOI();
   long unsigned int POP_SIZE;
   if (my_config->POP_SIZE() == -1) {
-    POP_SIZE = my_config->GRID_X() * my_config->GRID_Y();
+    POP_SIZE = (size_t) my_config->GRID_X() * my_config->GRID_Y();
   } else {
     POP_SIZE = my_config->POP_SIZE();
   }
@@ -55,8 +55,8 @@ void worldSetup(emp::Ptr<LysisWorld> world, emp::Ptr<SymConfigBase> my_config) {
 
   //This loop must be outside of the host generation loop since otherwise
   //syms try to inject into mostly empty spots at first
-  int total_syms = POP_SIZE * start_moi;
-  for (int j = 0; j < total_syms; j++){
+  size_t total_syms = POP_SIZE * start_moi;
+  for (size_t j = 0; j < total_syms; j++){
     double sym_int = 0;
     if (random_phen_sym) {sym_int = random.GetDouble(-1,1);}
     else {sym_int = my_config->SYM_INT();}
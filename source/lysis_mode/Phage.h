@@ -4,7 +4,7 @@
 #include "../default_mode/Symbiont.h"
 #include "LysisWorld.h"
 
-class Phage: public Symbiont {
+class Phage: public Symbiont, public CensusCounter<Phage> {
 protected:
 
   /**
@@ -25,28 +25,30 @@ protected:
     * Purpose: Represents the compatibility of the prophage to it's placement within the host's genome.
     *
   */
-  double incorporation_val = 0.0;
+  TraitValue incorporation_val = 0.0;
 
   /**
     *
     * Purpose: Represents the chance of lysis
     *
   */
-  double chance_of_lysis = 1;
+  TraitValue chance_of_lysis = 1;
 
   /**
     *
     * Purpose: Represents the chance of a prophage inducing to the lytic process
     *
   */
-  double induction_chance = 1;
+  TraitValue induction_chance = 1;
 
   /**
-    *
-    * Purpose: Represents the world that the phage are living in.
-    *
-  */
-  emp::Ptr<LysisWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The world that the phage are living in.
+   *
+   * Purpose: To reach the LysisWorld through the context shared with the other organisms.
+   */
+  emp::Ptr<LysisWorld> GetWorld() { return context->world.Cast<LysisWorld>(); }
 
 
 public:
@@ -54,19 +56,22 @@ public:
    * The constructor for phage
    */
   Phage(emp::Ptr<emp::Random> _random, emp::Ptr<LysisWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _points = 0.0) : Symbiont(_random, _world, _config, _intval, _points) {
-    chance_of_lysis = my_config->LYSIS_CHANCE();
-    induction_chance = my_config->CHANCE_OF_INDUCTION();
-    incorporation_val = my_config->PHAGE_INC_VAL();
-    if(chance_of_lysis == -1){
-      chance_of_lysis = random->GetDouble(0.0, 1.0);
+    //check the settings as doubles, since traits may be stored with less precision
+    double start_lysis_chance = context->config->LYSIS_CHANCE();
+    double start_induction_chance = context->config->CHANCE_OF_INDUCTION();
+    double start_incorporation_val = context->config->PHAGE_INC_VAL();
+    if(start_lysis_chance == -1){
+      start_lysis_chance = context->random->GetDouble(0.0, 1.0);
     }
-    if(induction_chance == -1){
-      induction_chance = random->GetDouble(0.0, 1.0);
+    if(start_induction_chance == -1){
+      start_induction_chance = context->random->GetDouble(0.0, 1.0);
     }
-    if(incorporation_val == -1){
-      incorporation_val = random->GetDouble(0.0, 1.0);
+    if(start_incorporation_val == -1){
+      start_incorporation_val = context->random->GetDouble(0.0, 1.0);
     }
-    my_world = _world;
+    chance_of_lysis = start_lysis_chance;
+    induction_chance = start_induction_chance;
+    incorporation_val = start_incorporation_val;
   }
 
 
@@ -110,6 +115,37 @@ public:
     return  "Phage";
   }
 
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the phage's state to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    Symbiont::AddToDigest(hasher);
+    hasher.Add(burst_timer);
+    hasher.Add(lysogeny);
+    hasher.Add((double) incorporation_val);
+    hasher.Add((double) chance_of_lysis);
+    hasher.Add((double) induction_chance);
+  }
+
+  /**
+  * Input: The genotype being built.
+  *
+  * Output: None
+  *
+  * Purpose: To add the phage's traits to its genotype.
+  */
+  void AddToGenotype(Genotype & _genotype) {
+    Symbiont::AddToGenotype(_genotype);
+    _genotype.inc_val = incorporation_val;
+    _genotype.lysis_chance = chance_of_lysis;
+    _genotype.induction_chance = induction_chance;
+  }
+
   /**Input: None
    *
    * Output: The double representing the phage's burst timer.
@@ -126,7 +162,7 @@ public:
    *
    * Purpose: To increment a phage's burst timer.
    */
-  void IncBurstTimer() {burst_timer += random->GetRandNormal(1.0, 1.0);}
+  void IncBurstTimer() {burst_timer += context->random->GetRandNormal(1.0, 1.0);}
 
 
   /**
@@ -226,7 +262,7 @@ public:
    * them being neutral.
    */
   void UponInjection() {
-    double rand_chance = random->GetDouble(0.0, 1.0);
+    double rand_chance = context->random->GetDouble(0.0, 1.0);
     if (rand_chance <= chance_of_lysis){
       lysogeny = false;
     } else {
@@ -247,22 +283,22 @@ public:
    */
   void Mutate() {
     Symbiont::Mutate();
-    double local_rate = my_config->MUTATION_RATE();
-    double local_size = my_config->MUTATION_SIZE();
-    if (random->GetDouble(0.0, 1.0) <= local_rate) {
+    double local_rate = context->config->MUTATION_RATE();
+    double local_size = context->config->MUTATION_SIZE();
+    if (context->random->GetDouble(0.0, 1.0) <= local_rate) {
       //mutate chance of lysis/lysogeny, if enabled
-      if(my_config->MUTATE_LYSIS_CHANCE()){
-        chance_of_lysis += random->GetRandNormal(0.0, local_size);
+      if(context->config->MUTATE_LYSIS_CHANCE()){
+        chance_of_lysis += context->random->GetRandNormal(0.0, local_size);
         if(chance_of_lysis < 0) chance_of_lysis = 0;
         else if (chance_of_lysis > 1) chance_of_lysis = 1;
       }
-      if(my_config->MUTATE_INDUCTION_CHANCE()){
-        induction_chance += random->GetRandNormal(0.0, local_size);
+      if(context->config->MUTATE_INDUCTION_CHANCE()){
+        induction_chance += context->random->GetRandNormal(0.0, local_size);
         if(induction_chance < 0) induction_chance = 0;
         else if (induction_chance > 1) induction_chance = 1;
       }
-      if(my_config->MUTATE_INC_VAL()){
-        incorporation_val += random->GetRandNormal(0.0, local_size);
+      if(context->config->MUTATE_INC_VAL()){
+        incorporation_val += context->random->GetRandNormal(0.0, local_size);
         if(incorporation_val < 0) incorporation_val = 0;
         else if (incorporation_val > 1) incorporation_val = 1;
       }
@@ -277,7 +313,7 @@ public:
    * Purpose: To produce a new symbiont, identical to the original
    */
   emp::Ptr<Organism> MakeNew() {
-    emp::Ptr<Phage> sym_baby = emp::NewPtr<Phage>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<Phage> sym_baby = emp::NewPtr<Phage>(context->random, GetWorld(), context->config, GetIntVal());
     // pass down parent's genome
     sym_baby->SetIncVal(GetIncVal());
     sym_baby->SetLysisChance(GetLysisChance());
@@ -294,17 +330,17 @@ public:
    * Purpose: To burst host and release offspring
    */
   void LysisBurst(emp::WorldPosition location){
-    emp::vector<emp::Ptr<Organism>>& repro_syms = my_host->GetReproSymbionts();
+    SymList& repro_syms = my_host->GetReproSymbionts();
     //Record the burst size and count
-    emp::DataMonitor<double>& data_node_burst_size = my_world->GetBurstSizeDataNode();
+    emp::DataMonitor<double>& data_node_burst_size = GetWorld()->GetBurstSizeDataNode();
     data_node_burst_size.AddDatum(repro_syms.size());
-    emp::DataMonitor<int>& data_node_burst_count = my_world->GetBurstCountDataNode();
+    emp::DataMonitor<int>& data_node_burst_count = GetWorld()->GetBurstCountDataNode();
     data_node_burst_count.AddDatum(1);
-    emp::DataMonitor<int>& data_node_attempts_horiztrans = my_world->GetHorizontalTransmissionAttemptCount();
-    emp::DataMonitor<int>& data_node_successes_horiztrans = my_world->GetHorizontalTransmissionSuccessCount();
+    emp::DataMonitor<int>& data_node_attempts_horiztrans = GetWorld()->GetHorizontalTransmissionAttemptCount();
+    emp::DataMonitor<int>& data_node_successes_horiztrans = GetWorld()->GetHorizontalTransmissionSuccessCount();
 
     for(size_t r=0; r<repro_syms.size(); r++) {
-      emp::WorldPosition new_pos = my_world->SymDoBirth(repro_syms[r], location);
+      emp::WorldPosition new_pos = GetWorld()->SymDoBirth(repro_syms[r], location);
 
       //horizontal transmission data nodes
       data_node_attempts_horiztrans.AddDatum(1);
@@ -326,15 +362,15 @@ public:
    */
   void LysisStep(){
     IncBurstTimer();
-    if(my_config->SYM_LYSIS_RES() == 0) {
+    if(context->config->SYM_LYSIS_RES() == 0) {
       std::cout << "Lysis with a sym_lysis_res of 0 leads to an \
       infinite loop, please change" << std::endl;
       std::exit(1);
     }
-    while(GetPoints() >= my_config->SYM_LYSIS_RES()) {
+    while(GetPoints() >= context->config->SYM_LYSIS_RES()) {
       emp::Ptr<Organism> sym_baby = Reproduce();
       my_host->AddReproSym(sym_baby);
-      SetPoints(GetPoints() - my_config->SYM_LYSIS_RES());
+      SetPoints(GetPoints() - context->config->SYM_LYSIS_RES());
     }
   }
 
@@ -354,7 +390,7 @@ public:
       host_baby->AddSymbiont(phage_baby);
 
       //vertical transmission data node
-      emp::DataMonitor<int>& data_node_attempts_verttrans = my_world->GetVerticalTransmissionAttemptCount();
+      emp::DataMonitor<int>& data_node_attempts_verttrans = GetWorld()->GetVerticalTransmissionAttemptCount();
       data_node_attempts_verttrans.AddDatum(1);
     }
   }
@@ -375,7 +411,7 @@ public:
       host = my_host;
     }
     if(lysogeny){
-      if(my_config->BENEFIT_TO_HOST()){
+      if(context->config->BENEFIT_TO_HOST()){
         return host->ProcessLysogenResources(incorporation_val);
       } else{
         return 0;
@@ -394,9 +430,9 @@ public:
    * Purpose: To process a phage, meaning check for reproduction, check for lysis, and move the phage.
    */
   void Process(emp::WorldPosition location) {
-    if(my_config->LYSIS() && !GetHost().IsNull()) { //lysis enabled and phage is in a host
+    if(context->config->LYSIS() && !GetHost().IsNull()) { //lysis enabled and phage is in a host
       if(!lysogeny){ //phage has chosen lysis
-        if(GetBurstTimer() >= my_config->BURST_TIME() ) { //time to lyse!
+        if(GetBurstTimer() >= context->config->BURST_TIME() ) { //time to lyse!
           LysisBurst(location);
         }
         else { //not time to lyse
@@ -404,18 +440,18 @@ public:
         }
       }
       else if(lysogeny){ //phage has chosen lysogeny
-        double rand_chance = random->GetDouble(0.0, 1.0);
+        double rand_chance = context->random->GetDouble(0.0, 1.0);
         if (rand_chance <= induction_chance){//phage has chosen to induce and turn lytic
           lysogeny = false;
         }
-        else if(random->GetDouble(0.0, 1.0) <= my_config->PROPHAGE_LOSS_RATE()){ //check if the phage's host should become susceptible again
+        else if(context->random->GetDouble(0.0, 1.0) <= context->config->PROPHAGE_LOSS_RATE()){ //check if the phage's host should become susceptible again
           SetDead();
         }
       }
     }
 
-    else if (GetHost().IsNull() && my_config->FREE_LIVING_SYMS()) { //phage is free living
-      my_world->MoveFreeSym(location);
+    else if (GetHost().IsNull() && context->config->FREE_LIVING_SYMS()) { //phage is free living
+      GetWorld()->MoveFreeSym(location);
     }
   }
 };
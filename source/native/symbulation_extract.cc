@@ -0,0 +1,112 @@
+#include "../default_mode/SymDataFile.h"
+#include "../default_mode/RecordStream.h"
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+/**
+ * Input: The name of a possibly encoded data file.
+ *
+ * Output: The bool representing if the file is delta encoded.
+ *
+ * Purpose: To recognize delta encoded files by their suffix.
+ */
+bool IsDeltaFileName(const std::string & filename) {
+  size_t suffix_len = DELTA_FILE_SUFFIX.size();
+  return filename.size() > suffix_len &&
+    filename.compare(filename.size() - suffix_len, suffix_len, DELTA_FILE_SUFFIX) == 0;
+}
+
+
+/**
+ * Input: The name of an encoded data file.
+ *
+ * Output: The name the decoded file should be written to.
+ *
+ * Purpose: To strip the encoding suffix so the decoded file has the name
+ * it would have had without encoding.
+ */
+std::string GetDecodedFileName(const std::string & filename) {
+  if (IsDeltaFileName(filename)) return filename.substr(0, filename.size() - DELTA_FILE_SUFFIX.size());
+  return filename + ".csv";
+}
+
+
+/**
+ * Input: The stream holding the contents of a data file; the name the file was
+ * written under.
+ *
+ * Output: None
+ *
+ * Purpose: To write a data file in the plain layout, decoding it first if it
+ * is delta encoded.
+ */
+void WriteDataFile(std::istream & in, const std::string & filename) {
+  if (IsDeltaFileName(filename)) {
+    std::string out_name = GetDecodedFileName(filename);
+    std::ofstream out(out_name);
+    size_t num_rows = DecodeDeltaData(in, out);
+    std::cout << "Wrote " << num_rows << " rows to " << out_name << std::endl;
+  } else {
+    std::ofstream out(filename);
+    out << in.rdbuf();
+    std::cout << "Wrote " << filename << std::endl;
+  }
+}
+
+
+// This is the main function for the data extraction tool.
+int symbulation_extract_main(int argc, char * argv[])
+{
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " FILE [FILE ...]" << std::endl;
+    std::cerr << "Each FILE is a record stream (.stream) or a delta encoded data file (.delta)." << std::endl;
+    return 1;
+  }
+
+  for (int i = 1; i < argc; i++) {
+    std::string in_name = argv[i];
+    std::ifstream in(in_name);
+    if (!in) {
+      std::cerr << "Could not open " << in_name << std::endl;
+      return 1;
+    }
+
+    std::string first_line;
+    if (!std::getline(in, first_line)) {
+      std::cerr << "Warning: " << in_name << " is empty, skipping it" << std::endl;
+      continue;
+    }
+    //a file of a single line without a newline leaves the eof flag set
+    in.clear();
+    in.seekg(0);
+
+    if (first_line == RECORD_STREAM_MAGIC) {
+      //split the stream back into the files the run would otherwise have written
+      std::map<std::string, std::stringstream> series;
+      bool complete = ReadRecordStream(in, series);
+      if (!complete) {
+        std::cerr << "Warning: " << in_name << " has no valid index footer, the run may not have finished" << std::endl;
+      }
+      for (auto & named_series : series) {
+        WriteDataFile(named_series.second, named_series.first);
+      }
+    } else if (IsDeltaFileName(in_name)) {
+      WriteDataFile(in, in_name);
+    } else {
+      std::cerr << in_name << " is neither a record stream nor a delta encoded file" << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*
+This definition guard prevents main from being defined twice during testing.
+*/
+#ifndef CATCH_CONFIG_MAIN
+int main(int argc, char * argv[]) {
+  return symbulation_extract_main(argc, argv);
+}
+#endif
@@ -5,7 +5,7 @@
 #include "PGGWorld.h"
 
 
-class PGGHost: public Host {
+class PGGHost: public Host, public CensusCounter<PGGHost> {
 protected:
 
   /**
@@ -16,17 +16,19 @@ protected:
   double sourcepool = 0;
 
   /**
-    *
-    * Purpose: Represents the world that the PGGHosts are living in.
-    *
-  */
-  emp::Ptr<PGGWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The world that the PGGHosts are living in.
+   *
+   * Purpose: To reach the PGGWorld through the context shared with the other organisms.
+   */
+  emp::Ptr<PGGWorld> GetWorld() { return context->world.Cast<PGGWorld>(); }
 
 public:
   PGGHost(emp::Ptr<emp::Random> _random, emp::Ptr<PGGWorld> _world, emp::Ptr<SymConfigBase> _config,
   double _intval =0.0, emp::vector<emp::Ptr<Organism>> _syms = {},
   emp::vector<emp::Ptr<Organism>> _repro_syms = {},
-  double _points = 0.0) : Host(_random, _world, _config, _intval,_syms, _repro_syms, _points) {my_world = _world;}
+  double _points = 0.0) : Host(_random, _world, _config, _intval,_syms, _repro_syms, _points) {}
 
 
   /**
@@ -69,6 +71,19 @@ public:
     return  "PGGHost";
   }
 
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the PGG host's state to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    Host::AddToDigest(hasher);
+    hasher.Add(sourcepool);
+  }
+
   /**
    * Input: None
    *
@@ -129,7 +144,7 @@ public:
   void DistribPool(){
     //to do: marginal return
     int num_sym = syms.size();
-    double bonus = my_config->PGG_SYNERGY();
+    double bonus = context->config->PGG_SYNERGY();
     double sym_piece = (double) sourcepool / num_sym;
     for(size_t i=0; i < syms.size(); i++){
         syms[i]->AddPoints(sym_piece*bonus);
@@ -145,7 +160,7 @@ public:
    * Purpose: To avoid creating an organism via constructor in other methods.
    */
   emp::Ptr<Organism> MakeNew(){
-    emp::Ptr<PGGHost> host_baby = emp::NewPtr<PGGHost>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<PGGHost> host_baby = emp::NewPtr<PGGHost>(context->random, GetWorld(), context->config, GetIntVal());
     return host_baby;
   }
 
@@ -4,7 +4,7 @@
 #include "../default_mode/Symbiont.h"
 #include "PGGWorld.h"
 
-class PGGSymbiont: public Symbiont {
+class PGGSymbiont: public Symbiont, public CensusCounter<PGGSymbiont> {
 protected:
 
   /**
@@ -12,18 +12,20 @@ protected:
     * Purpose: the donation value for this symbiont.
     *
   */
-  double PGG_donate = 0;
+  TraitValue PGG_donate = 0;
 
   /**
-    *
-    * Purpose: Represents the world that the pgg symbionts are living in.
-    *
-  */
-  emp::Ptr<PGGWorld> my_world = NULL;
+   * Input: None
+   *
+   * Output: The world that the pgg symbionts are living in.
+   *
+   * Purpose: To reach the PGGWorld through the context shared with the other organisms.
+   */
+  emp::Ptr<PGGWorld> GetWorld() { return context->world.Cast<PGGWorld>(); }
 
 public:
   PGGSymbiont(emp::Ptr<emp::Random> _random, emp::Ptr<PGGWorld> _world, emp::Ptr<SymConfigBase> _config, double _intval=0.0, double _donation = 0.0, double _points = 0.0 ) : Symbiont(_random, _world, _config, _intval, _points),PGG_donate(_donation)
-  {my_world = _world;}
+  {}
 
 
   /**
@@ -86,6 +88,42 @@ public:
     return  "PGGSymbiont";
   }
 
+
+  /**
+   * Input: None
+   *
+   * Output: The bool representing if the symbiont processes resources with
+   * Symbiont::ProcessResources, which PGGSymbionts do.
+   *
+   * Purpose: To let hosts compute this symbiont's share with ResourceKernel.
+   */
+  bool HasDefaultResourceProcessing() {return InheritsProcessResources<PGGSymbiont>();}
+
+
+  /**
+  * Input: The StateHasher building the digest.
+  * 
+  * Output: None
+  *
+  * Purpose: To add the PGG symbiont's state to a digest of the world.
+  */
+  void AddToDigest(StateHasher & hasher) {
+    Symbiont::AddToDigest(hasher);
+    hasher.Add((double) PGG_donate);
+  }
+
+  /**
+  * Input: The genotype being built.
+  *
+  * Output: None
+  *
+  * Purpose: To add the PGG symbiont's traits to its genotype.
+  */
+  void AddToGenotype(Genotype & _genotype) {
+    Symbiont::AddToGenotype(_genotype);
+    _genotype.donation = PGG_donate;
+  }
+
   /**
    * Input: None
    *
@@ -117,8 +155,8 @@ public:
    */
   void Mutate(){
     Symbiont::Mutate();
-    if (random->GetDouble(0.0, 1.0) <= my_config->MUTATION_RATE()) {
-      PGG_donate += random->GetRandNormal(0.0, my_config->MUTATION_SIZE());
+    if (context->random->GetDouble(0.0, 1.0) <= context->config->MUTATION_RATE()) {
+      PGG_donate += context->random->GetRandNormal(0.0, context->config->MUTATION_SIZE());
       if(PGG_donate < 0) PGG_donate = 0;
       else if (PGG_donate > 1) PGG_donate = 1;
     }
@@ -150,7 +188,7 @@ public:
    * Purpose: To produce a new PGGSymbiont, identical to the original
    */
   emp::Ptr<Organism> MakeNew() {
-    emp::Ptr<PGGSymbiont> sym_baby = emp::NewPtr<PGGSymbiont>(random, my_world, my_config, GetIntVal());
+    emp::Ptr<PGGSymbiont> sym_baby = emp::NewPtr<PGGSymbiont>(context->random, GetWorld(), context->config, GetIntVal());
     sym_baby->SetInfectionChance(GetInfectionChance());
     sym_baby->SetDonation(GetDonation());
     return sym_baby;
@@ -4,6 +4,9 @@
 #include "../default_mode/SymWorld.h"
 #include "../default_mode/DataNodes.h"
 
+class PGGHost;
+class PGGSymbiont;
+
 class PGGWorld : public SymWorld {
 private:
   /**
@@ -36,7 +39,22 @@ public:
   void CreateDateFiles(){
     std::string file_ending = "_SEED"+std::to_string(my_config->SEED())+".data";
     SymWorld::CreateDateFiles();
-    SetupPGGSymIntValFile(my_config->FILE_PATH()+"PGGSymVals"+my_config->FILE_NAME()+file_ending).SetTimingRepeat(my_config->DATA_INT());
+    if(IsDataEnabled("PGGSymVals")){
+      SetupPGGSymIntValFile(my_config->FILE_PATH()+"PGGSymVals"+my_config->FILE_NAME()+file_ending).SetTiming(GetDataTimingFun());
+    }
+  }
+
+  /**
+   * Input: The SymDataFile object tracking the census.
+   *
+   * Output: None.
+   *
+   * Purpose: To add PGGHost and PGGSymbiont objects to the census.
+   */
+  void SetupCensusColumns(SymDataFile & file){
+    SymWorld::SetupCensusColumns(file);
+    AddCensusColumns<PGGHost>(file, "pgg_host");
+    AddCensusColumns<PGGSymbiont>(file, "pgg_sym");
   }
 
 
@@ -55,27 +73,34 @@ public:
     */
   emp::DataFile & SetupPGGSymIntValFile(const std::string & filename) {
     auto & file = SetupFile(filename);
-    auto & node1 = GetSymCountDataNode();
-    auto & node2 = GetCountFreeSymsDataNode();
-    auto & node3 = GetCountHostedSymsDataNode();
-    auto & node4 = GetPGGDataNode();
 
     file.AddVar(update, "update", "Update");
-    file.AddTotal(node1, "count", "Total number of symbionts");
-    file.AddTotal(node2, "free_syms", "Total number of free syms");
-    file.AddTotal(node3, "hosted_syms", "Total number of syms in a host");
-    file.AddMean(node4, "PGG_donationrate","Average donation rate");
+    if(IsDataEnabled("PGGSymVals", "count")){
+      file.AddTotal(GetSymCountDataNode(), "count", "Total number of symbionts");
+    }
+    if(IsDataEnabled("PGGSymVals", "free_syms")){
+      file.AddTotal(GetCountFreeSymsDataNode(), "free_syms", "Total number of free syms");
+    }
+    if(IsDataEnabled("PGGSymVals", "hosted_syms")){
+      file.AddTotal(GetCountHostedSymsDataNode(), "hosted_syms", "Total number of syms in a host");
+    }
+    if(IsDataEnabled("PGGSymVals", "PGG_donationrate")){
+      file.AddMean(GetPGGDataNode(), "PGG_donationrate","Average donation rate");
+    }
 
-    file.AddHistBin(node4, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
-    file.AddHistBin(node4, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
-    file.AddHistBin(node4, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
-    file.AddHistBin(node4, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
-    file.AddHistBin(node4, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
-    file.AddHistBin(node4, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
-    file.AddHistBin(node4, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
-    file.AddHistBin(node4, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
-    file.AddHistBin(node4, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
-    file.AddHistBin(node4, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+    if(IsDataEnabled("PGGSymVals", "Hist")){
+      auto & node4 = GetPGGDataNode();
+      file.AddHistBin(node4, 0, "Hist_0.0", "Count for histogram bin 0.0 to <0.1");
+      file.AddHistBin(node4, 1, "Hist_0.1", "Count for histogram bin 0.1 to <0.2");
+      file.AddHistBin(node4, 2, "Hist_0.2", "Count for histogram bin 0.2 to <0.3");
+      file.AddHistBin(node4, 3, "Hist_0.3", "Count for histogram bin 0.3 to <0.4");
+      file.AddHistBin(node4, 4, "Hist_0.4", "Count for histogram bin 0.4 to <0.5");
+      file.AddHistBin(node4, 5, "Hist_0.5", "Count for histogram bin 0.5 to <0.6");
+      file.AddHistBin(node4, 6, "Hist_0.6", "Count for histogram bin 0.6 to <0.7");
+      file.AddHistBin(node4, 7, "Hist_0.7", "Count for histogram bin 0.7 to <0.8");
+      file.AddHistBin(node4, 8, "Hist_0.8", "Count for histogram bin 0.8 to <0.9");
+      file.AddHistBin(node4, 9, "Hist_0.9", "Count for histogram bin 0.9 to 1.0");
+    }
 
 
     file.PrintHeaderKeys();
@@ -100,7 +125,7 @@ public:
         data_node_PGG->Reset();
         for (size_t i = 0; i< pop.size(); i++) {
           if (IsOccupied(i)) { //track hosted syms
-            emp::vector<emp::Ptr<Organism>>& syms = pop[i]->GetSymbionts();
+            SymList& syms = pop[i]->GetSymbionts();
             size_t sym_size = syms.size();
             for(size_t j=0; j< sym_size; j++){
               data_node_PGG->AddDatum(syms[j]->GetDonation());
@@ -0,0 +1,60 @@
+#include "../../default_mode/AbundanceIndex.h"
+
+TEST_CASE("AbundanceIndex dominant key", "[default]"){
+  GIVEN("an empty abundance index"){
+    AbundanceIndex<int> index;
+    THEN("there is no dominant key"){
+      REQUIRE(index.GetMaxCount() == 0);
+      REQUIRE(index.GetNumKeys() == 0);
+      REQUIRE(index.GetDominant() == 0);
+    }
+
+    WHEN("keys are added"){
+      index.Add(5);
+      index.Add(7);
+      index.Add(7);
+      index.Add(9, 3);
+
+      THEN("the key with the highest count is dominant"){
+        REQUIRE(index.GetDominant() == 9);
+        REQUIRE(index.GetMaxCount() == 3);
+        REQUIRE(index.GetCount(7) == 2);
+        REQUIRE(index.GetNumKeys() == 3);
+      }
+
+      WHEN("the dominant key loses abundance"){
+        index.Remove(9, 2);
+        index.Add(7);
+        THEN("the new most abundant key is dominant"){
+          REQUIRE(index.GetDominant() == 7);
+          REQUIRE(index.GetMaxCount() == 3);
+          REQUIRE(index.GetCount(9) == 1);
+        }
+      }
+
+      WHEN("keys are removed entirely"){
+        index.Remove(9, 10);
+        index.Remove(7);
+        index.Remove(7);
+        index.Remove(3);
+        THEN("they are forgotten"){
+          REQUIRE(index.GetCount(9) == 0);
+          REQUIRE(index.GetNumKeys() == 1);
+          REQUIRE(index.GetDominant() == 5);
+          REQUIRE(index.GetMaxCount() == 1);
+        }
+      }
+    }
+  }
+
+  GIVEN("an abundance index of pairs"){
+    AbundanceIndex<std::pair<int, int>, PairHash> index;
+    index.Add({1, 2});
+    index.Add({2, 1});
+    index.Add({2, 1});
+    THEN("pairs are counted separately"){
+      REQUIRE(index.GetDominant() == std::make_pair(2, 1));
+      REQUIRE(index.GetCount({1, 2}) == 1);
+    }
+  }
+}
@@ -0,0 +1,162 @@
+#include "../../default_mode/AdaptiveTiming.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/Host.h"
+
+TEST_CASE("AdaptiveTiming ShouldPrint", "[default]"){
+  GIVEN("an adaptive timing with a minimum of 2 updates and a maximum of 10"){
+    AdaptiveTiming timing(2, 10, 5, 0.1, 0.05, 0.2);
+    AdaptiveTiming::Stats stats;
+    stats.host_count = 100;
+    stats.sym_count = 50;
+    stats.host_hist = {50, 50};
+    stats.sym_hist = {25, 25};
+
+    THEN("the first update always prints"){
+      REQUIRE(timing.ShouldPrint(0, stats));
+    }
+
+    WHEN("nothing changes"){
+      emp::vector<size_t> printed;
+      for (size_t update = 0; update <= 20; update++) {
+        if (timing.ShouldPrint(update, stats)) printed.push_back(update);
+      }
+      THEN("rows are printed every max interval"){
+        REQUIRE(printed == emp::vector<size_t>({0, 10, 20}));
+      }
+    }
+
+    WHEN("the host count changes past the threshold"){
+      REQUIRE(timing.ShouldPrint(0, stats));
+      stats.host_count = 120;
+      THEN("a row is printed once the minimum interval has passed"){
+        REQUIRE(timing.ShouldPrint(1, stats) == false);
+        REQUIRE(timing.ShouldPrint(2, stats));
+        REQUIRE(timing.ShouldPrint(3, stats) == false);
+      }
+    }
+
+    WHEN("the mean interaction value changes past the threshold"){
+      REQUIRE(timing.ShouldPrint(0, stats));
+      stats.sym_mean = 0.1;
+      THEN("a row is printed"){
+        REQUIRE(timing.ShouldPrint(2, stats));
+      }
+    }
+
+    WHEN("the histogram shape changes past the threshold"){
+      REQUIRE(timing.ShouldPrint(0, stats));
+      stats.host_hist = {80, 20};
+      THEN("a row is printed"){
+        REQUIRE(timing.ShouldPrint(2, stats));
+      }
+    }
+
+    WHEN("the symbionts go extinct"){
+      REQUIRE(timing.ShouldPrint(0, stats));
+      REQUIRE(timing.ShouldPrint(3, stats) == false);
+      stats.sym_count = 0;
+      stats.sym_hist = {0, 0};
+      THEN("a row is printed immediately and then every minimum interval for the event window, then falls back to the maximum interval"){
+        REQUIRE(timing.ShouldPrint(4, stats));
+        REQUIRE(timing.ShouldPrint(5, stats) == false);
+        REQUIRE(timing.ShouldPrint(6, stats));
+        REQUIRE(timing.ShouldPrint(8, stats));
+        REQUIRE(timing.ShouldPrint(10, stats) == false);
+        REQUIRE(timing.ShouldPrint(14, stats) == false);
+        REQUIRE(timing.ShouldPrint(18, stats));
+      }
+    }
+
+    WHEN("the same update is asked about twice"){
+      REQUIRE(timing.ShouldPrint(0, stats));
+      THEN("the same answer is given, regardless of the statistics"){
+        stats.host_count = 0;
+        REQUIRE(timing.HasDecided(0));
+        REQUIRE(timing.ShouldPrint(0, stats));
+        REQUIRE(timing.HasDecided(1) == false);
+      }
+    }
+  }
+}
+
+TEST_CASE("ADAPTIVE_DATA prints more rows while the population changes", "[default]"){
+  GIVEN("a world with a growing host population and adaptive data on"){
+    emp::Random random(23);
+    SymConfigBase config;
+    config.SEED(23);
+    config.DATA_INT(50);
+    config.ADAPTIVE_DATA(1);
+    config.ADAPTIVE_MIN_INT(1);
+    config.FILE_NAME("_adaptive_test");
+    config.DATA_MANIFEST("HostVals");
+    std::string file_name = "HostVals_adaptive_test_SEED23.data";
+
+    {
+      SymWorld world(random, &config);
+      world.Resize(100);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 0);
+      world.CreateDateFiles();
+      for (int i = 0; i < 30; i++) world.Update();
+    }
+
+    WHEN("the host file is read"){
+      std::ifstream in(file_name);
+      std::string line;
+      size_t num_rows = 0;
+      std::getline(in, line);
+      while (std::getline(in, line)) num_rows++;
+
+      THEN("more rows than DATA_INT alone would give are written, but not every update"){
+        REQUIRE(num_rows > 1);
+        REQUIRE(num_rows <= 30);
+      }
+    }
+    std::remove(file_name.c_str());
+  }
+}
+
+TEST_CASE("ADAPTIVE_DATA records the interval of transmission totals", "[default]"){
+  GIVEN("a world with adaptive data writing transmission totals"){
+    emp::Random random(23);
+    SymConfigBase config;
+    config.SEED(23);
+    config.DATA_INT(50);
+    config.ADAPTIVE_DATA(1);
+    config.ADAPTIVE_MIN_INT(1);
+    config.FILE_NAME("_adaptive_interval_test");
+    config.DATA_MANIFEST("HostVals,TransmissionRates");
+    std::string file_name = "TransmissionRates_adaptive_interval_test_SEED23.data";
+
+    {
+      SymWorld world(random, &config);
+      world.Resize(100);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 0);
+      world.CreateDateFiles();
+      for (int i = 0; i < 30; i++) world.Update();
+    }
+
+    WHEN("the transmission file is read"){
+      std::ifstream in(file_name);
+      std::string line;
+      std::getline(in, line);
+
+      THEN("each row gives the number of updates since the previous row"){
+        REQUIRE(line == "update,interval,attempts_horiztrans,successes_horiztrans,attempts_verttrans");
+        size_t prev_update = 0;
+        size_t num_rows = 0;
+        while (std::getline(in, line)) {
+          std::stringstream cells(line);
+          std::string update, interval;
+          std::getline(cells, update, ',');
+          std::getline(cells, interval, ',');
+          REQUIRE(std::stoul(interval) == std::stoul(update) - prev_update);
+          prev_update = std::stoul(update);
+          num_rows++;
+        }
+        REQUIRE(num_rows > 1);
+      }
+    }
+    std::remove(file_name.c_str());
+    std::remove("HostVals_adaptive_interval_test_SEED23.data");
+  }
+}
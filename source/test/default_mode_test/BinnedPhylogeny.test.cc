@@ -0,0 +1,164 @@
+#include "../../default_mode/BinnedPhylogeny.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+TEST_CASE("BinnedPhylogeny counts and origins", "[default]"){
+  GIVEN("a binned phylogeny with 5 bins"){
+    BinnedPhylogeny phylo(5);
+    size_t none = BinnedPhylogeny::NO_BIN;
+
+    WHEN("an organism is added without a parent"){
+      phylo.AddOrg(2, none, 0);
+      THEN("its bin becomes active with no ancestor"){
+        REQUIRE(phylo.GetNumActive() == 1);
+        REQUIRE(phylo.GetNumOrgs(2) == 1);
+        REQUIRE(phylo.GetOrigin(2) == none);
+        REQUIRE(phylo.GetOriginationTime(2) == 0);
+      }
+    }
+
+    WHEN("offspring are born into the same and other bins"){
+      phylo.AddOrg(2, none, 0);
+      phylo.AddOrg(2, 2, 1);
+      phylo.AddOrg(3, 2, 2);
+      phylo.AddOrg(4, 3, 3);
+      phylo.AddOrg(3, 2, 4);
+
+      THEN("counts, origins and transitions are recorded"){
+        REQUIRE(phylo.GetNumActive() == 3);
+        REQUIRE(phylo.GetNumOrgs(2) == 2);
+        REQUIRE(phylo.GetNumOrgs(3) == 2);
+        REQUIRE(phylo.GetOrigin(3) == 2);
+        REQUIRE(phylo.GetOrigin(4) == 3);
+        REQUIRE(phylo.GetOriginationTime(3) == 2);
+        REQUIRE(phylo.GetTransitions(2, 2) == 1);
+        REQUIRE(phylo.GetTransitions(2, 3) == 2);
+        REQUIRE(phylo.GetTransitions(3, 4) == 1);
+      }
+
+      WHEN("a bin goes extinct and is repopulated"){
+        phylo.RemoveOrg(4, 5);
+        REQUIRE(phylo.GetNumActive() == 2);
+        REQUIRE(phylo.GetDestructionTime(4) == 5);
+        phylo.AddOrg(4, 2, 6);
+        THEN("it originates again from the new parent bin"){
+          REQUIRE(phylo.GetNumActive() == 3);
+          REQUIRE(phylo.GetOrigin(4) == 2);
+          REQUIRE(phylo.GetOriginationTime(4) == 6);
+          REQUIRE(phylo.GetTotOrgs(4) == 2);
+        }
+      }
+    }
+
+    WHEN("organisms are tracked by position"){
+      phylo.AddOrgAt(0, 1, none, 0);
+      phylo.AddOrgAt(1, 1, phylo.GetBinAt(0), 1);
+      phylo.AddOrgAt(1, 4, phylo.GetBinAt(0), 2);
+      THEN("placing an organism over another removes the old one"){
+        REQUIRE(phylo.GetNumOrgs(1) == 1);
+        REQUIRE(phylo.GetNumOrgs(4) == 1);
+        REQUIRE(phylo.GetBinAt(1) == 4);
+      }
+      phylo.RemoveOrgAt(0, 3);
+      THEN("removing by position empties the position"){
+        REQUIRE(phylo.GetBinAt(0) == none);
+        REQUIRE(phylo.GetNumOrgs(1) == 0);
+      }
+    }
+
+    WHEN("an organism is placed in a bin beyond the initial number of bins"){
+      phylo.AddOrg(1, none, 0);
+      phylo.AddOrg(7, 1, 1);
+      THEN("the tracker grows and keeps earlier transitions"){
+        REQUIRE(phylo.GetNumBins() == 8);
+        REQUIRE(phylo.GetTransitions(1, 7) == 1);
+        REQUIRE(phylo.GetNumOrgs(1) == 1);
+      }
+    }
+  }
+}
+
+TEST_CASE("Binned phylogeny tracking in SymWorld", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.MUTATION_SIZE(0.09);
+  config.MUTATION_RATE(1);
+  config.PHYLOGENY(1);
+  config.PHYLOGENY_TRACKER("binned");
+  config.NUM_PHYLO_BINS(20);
+  config.FREE_LIVING_SYMS(1);
+  SymWorld world(random, &config);
+  world.Resize(10);
+
+  emp::Ptr<BinnedPhylogeny> host_phylo = world.GetHostBinSys();
+  emp::Ptr<BinnedPhylogeny> sym_phylo = world.GetSymBinSys();
+  REQUIRE(world.GetHostSys() == nullptr);
+  REQUIRE(world.GetSymSys() == nullptr);
+
+  WHEN("hosts are born and replaced"){
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 0);
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 1, 0);
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, -1), 1, 0);
+
+    THEN("the host tracker follows the population"){
+      REQUIRE(host_phylo->GetNumOrgs(10) == 1);
+      REQUIRE(host_phylo->GetNumOrgs(15) == 0);
+      REQUIRE(host_phylo->GetNumOrgs(0) == 1);
+      REQUIRE(host_phylo->GetOrigin(0) == 10);
+      REQUIRE(host_phylo->GetTransitions(10, 15) == 1);
+    }
+
+    world.DoDeath(0);
+    THEN("a host death is recorded"){
+      REQUIRE(host_phylo->GetNumOrgs(10) == 0);
+      REQUIRE(host_phylo->GetNumActive() == 1);
+    }
+  }
+
+  WHEN("symbionts reproduce and die"){
+    emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+    world.AddSymToSystematic(sym);
+    emp::Ptr<Organism> sym_baby = sym->Reproduce();
+
+    THEN("births are recorded against the parent's bin"){
+      REQUIRE(sym->GetPhyloID() == 10);
+      REQUIRE(sym_phylo->GetTotOrgs(sym_baby->GetPhyloID()) >= 1);
+      REQUIRE(sym_phylo->GetTransitions(10, sym_baby->GetPhyloID()) == 1);
+    }
+
+    sym.Delete();
+    sym_baby.Delete();
+    THEN("deaths empty the bins"){
+      REQUIRE(sym_phylo->GetNumActive() == 0);
+    }
+  }
+
+  WHEN("the phylogeny is written"){
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 0);
+    world.WritePhylogenyFile("binned_phylo_test.data");
+    std::ifstream in("HostSnapshot_binned_phylo_test.data");
+    std::string header, row;
+    std::getline(in, header);
+    std::getline(in, row);
+
+    THEN("it uses the emp::Systematics snapshot layout"){
+      REQUIRE(header == "id,ancestor_list,origin_time,destruction_time,num_orgs,tot_orgs,num_offspring,total_offspring,depth,info");
+      REQUIRE(row == "10,[NONE],0,inf,1,1,0,0,0,10");
+    }
+    for (std::string prefix : {"HostSnapshot_", "SymSnapshot_", "HostTransitions_", "SymTransitions_"}) {
+      std::remove((prefix + "binned_phylo_test.data").c_str());
+    }
+  }
+}
+
+TEST_CASE("Unknown phylogeny trackers are rejected", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.PHYLOGENY(1);
+  config.PHYLOGENY_TRACKER("binnned");
+  REQUIRE_THROWS(SymWorld(random, &config));
+
+  config.PHYLOGENY(0);
+  REQUIRE_NOTHROW(SymWorld(random, &config));
+}
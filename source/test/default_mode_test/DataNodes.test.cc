@@ -741,3 +741,133 @@ TEST_CASE("GetVerticalTransmissionAttemptCount", "[default]"){
     }
   }
 }
+
+TEST_CASE("DATA_MANIFEST", "[default]"){
+  GIVEN( "a world with a manifest listing two host columns" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FILE_NAME("_manifest_test");
+    config.DATA_MANIFEST("HostVals:count,HostVals:mean_intval");
+    std::string file_ending = "_manifest_test_SEED10.data";
+
+    THEN("only the listed files and columns are enabled"){
+      SymWorld world(random, &config);
+      REQUIRE(world.IsDataEnabled("HostVals") == true);
+      REQUIRE(world.IsDataEnabled("HostVals", "count") == true);
+      REQUIRE(world.IsDataEnabled("HostVals", "mean_intval") == true);
+      REQUIRE(world.IsDataEnabled("HostVals", "Hist") == false);
+      REQUIRE(world.IsDataEnabled("SymVals") == false);
+      REQUIRE(world.IsDataEnabled("TransmissionRates", "attempts_verttrans") == false);
+
+      config.DATA_MANIFEST("SymVals");
+      REQUIRE(world.IsDataEnabled("SymVals", "Hist") == true);
+      REQUIRE(world.IsDataEnabled("HostVals") == false);
+
+      config.DATA_MANIFEST("all");
+      REQUIRE(world.IsDataEnabled("TransmissionRates", "attempts_verttrans") == true);
+
+      config.DATA_MANIFEST(" HostVals, SymVals ,TransmissionRates : attempts_verttrans ");
+      REQUIRE(world.IsDataEnabled("HostVals") == true);
+      REQUIRE(world.IsDataEnabled("SymVals") == true);
+      REQUIRE(world.IsDataEnabled("TransmissionRates", "attempts_verttrans") == true);
+      REQUIRE(world.IsDataEnabled("TransmissionRates", "attempts_horiztrans") == false);
+    }
+
+    WHEN("only the horizontal transmission successes are listed"){
+      config.DATA_MANIFEST("TransmissionRates:successes_horiztrans");
+      {
+        SymWorld world(random, &config);
+        world.CreateDateFiles();
+        world.Update();
+      }
+      THEN("the world is destroyed without touching the attempts node"){
+        std::ifstream trans_file("TransmissionRates" + file_ending);
+        std::string header;
+        std::getline(trans_file, header);
+        REQUIRE(header == "update,successes_horiztrans");
+      }
+      std::remove(("TransmissionRates" + file_ending).c_str());
+    }
+
+    WHEN("the data files are created"){
+      {
+        SymWorld world(random, &config);
+        world.CreateDateFiles();
+        world.Update();
+      }
+
+      THEN("only the listed columns are written, in their usual order"){
+        std::ifstream host_file("HostVals" + file_ending);
+        std::string header;
+        std::getline(host_file, header);
+        REQUIRE(header == "update,mean_intval,count");
+
+        std::ifstream sym_file("SymVals" + file_ending);
+        REQUIRE(!sym_file.good());
+      }
+
+      std::remove(("HostVals" + file_ending).c_str());
+    }
+  }
+}
+
+TEST_CASE("Census file", "[default]"){
+  GIVEN( "a world with the census on" ) {
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FILE_NAME("_census_test");
+    config.DATA_MANIFEST("Census");
+    config.CENSUS_DATA(1);
+    config.DATA_INT(1);
+    config.MUTATION_SIZE(0);
+    std::string file_name = "Census_census_test_SEED10.data";
+    size_t live_hosts = CensusCounter<Host>::GetNumLive();
+    size_t live_syms = CensusCounter<Symbiont>::GetNumLive();
+
+    WHEN("hosts and symbionts are added and one host is removed"){
+      {
+        SymWorld world(random, &config);
+        world.Resize(4);
+        world.CreateDateFiles();
+        for (size_t i = 0; i < 3; i++) {
+          emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0);
+          host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, 0));
+          world.AddOrgAt(host, i);
+        }
+        REQUIRE(CensusCounter<Host>::GetNumLive() == live_hosts + 3);
+        REQUIRE(CensusCounter<Symbiont>::GetNumLive() == live_syms + 3);
+        world.Update();
+        world.DoDeath(0);
+        REQUIRE(CensusCounter<Host>::GetNumLive() == live_hosts + 2);
+        REQUIRE(CensusCounter<Symbiont>::GetNumLive() == live_syms + 2);
+      }
+
+      THEN("every object is deleted with the world"){
+        REQUIRE(CensusCounter<Host>::GetNumLive() == live_hosts);
+        REQUIRE(CensusCounter<Symbiont>::GetNumLive() == live_syms);
+      }
+
+      THEN("the census records the live objects and the births since the previous row"){
+        std::ifstream census(file_name);
+        std::string header, row;
+        std::getline(census, header);
+        std::getline(census, row);
+        REQUIRE(header == "update,host_live,host_births,host_deletions,sym_live,sym_births,sym_deletions,syms_bytes,repro_syms_bytes,peak_memory_kb");
+        std::stringstream cells(row);
+        emp::vector<std::string> values;
+        std::string value;
+        while (std::getline(cells, value, ',')) values.push_back(value);
+        REQUIRE(values.size() == 10);
+        REQUIRE(values[0] == "0");
+        REQUIRE(values[1] == std::to_string(live_hosts + 3));
+        REQUIRE(values[2] == "3");
+        REQUIRE(values[3] == "0");
+        REQUIRE(values[5] == "3");
+        //a single symbiont is stored inline, without heap memory
+        REQUIRE(values[7] == "0");
+      }
+
+      std::remove(file_name.c_str());
+    }
+  }
+}
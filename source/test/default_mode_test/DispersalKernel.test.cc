@@ -0,0 +1,140 @@
+#include "../../default_mode/DispersalKernel.h"
+#include "../../default_mode/Host.h"
+
+TEST_CASE("AliasTable draws", "[default]"){
+  emp::Random random(23);
+  AliasTable table;
+
+  WHEN("the weights are uneven"){
+    table.Build({1, 0, 3, 6});
+    THEN("indices are drawn in proportion to their weights"){
+      emp::vector<size_t> counts(4, 0);
+      size_t draws = 100000;
+      for (size_t i = 0; i < draws; i++) counts[table.Draw(random)]++;
+      REQUIRE(counts[1] == 0);
+      REQUIRE(counts[0] / (double) draws == Approx(0.1).margin(0.01));
+      REQUIRE(counts[2] / (double) draws == Approx(0.3).margin(0.01));
+      REQUIRE(counts[3] / (double) draws == Approx(0.6).margin(0.01));
+    }
+  }
+
+  WHEN("the weights are all 0"){
+    THEN("building the table throws"){
+      REQUIRE_THROWS(table.Build({0, 0}));
+    }
+  }
+}
+
+TEST_CASE("DispersalKernel offsets", "[default]"){
+  emp::Random random(29);
+  DispersalKernel kernel;
+
+  WHEN("the kernel reaches 2 cells"){
+    kernel.Build("exponential", 1, 0, 2);
+    THEN("it has the 12 cells within 2 cells, and not the origin"){
+      REQUIRE(kernel.GetNumOffsets() == 12);
+      for (size_t i = 0; i < 100; i++) {
+        size_t cell = kernel.Disperse(55, 10, 10, true, random);
+        int dx = (int) (cell % 10) - 5, dy = (int) (cell / 10) - 5;
+        REQUIRE(cell != 55);
+        REQUIRE(dx * dx + dy * dy <= 4);
+      }
+    }
+  }
+
+  WHEN("the kernel is a steep power law"){
+    kernel.Build("power_law", 0, 6, 5);
+    THEN("most dispersals go to the nearest cells"){
+      size_t near = 0;
+      for (size_t i = 0; i < 1000; i++) {
+        size_t cell = kernel.Disperse(55, 10, 10, true, random);
+        if (cell == 45 || cell == 54 || cell == 56 || cell == 65) near++;
+      }
+      REQUIRE(near > 700);
+    }
+  }
+
+  WHEN("the grid does not wrap"){
+    kernel.Build("exponential", 100, 0, 3);
+    THEN("dispersals past the edge are lost"){
+      size_t lost = 0;
+      for (size_t i = 0; i < 200; i++) {
+        size_t cell = kernel.Disperse(0, 10, 10, false, random);
+        if (cell == (size_t) -1) lost++;
+        else REQUIRE(cell < 100);
+      }
+      REQUIRE(lost > 0);
+      REQUIRE(lost < 200);
+    }
+  }
+
+  WHEN("the grid is hexagonal"){
+    kernel.Build("exponential", 1, 0, 1, true);
+    THEN("it has the 6 surrounding hexagons, from even and odd rows"){
+      REQUIRE(kernel.GetNumOffsets() == 6);
+      std::set<size_t> even_neighbors = {4, 5, 8, 10, 12, 13};
+      std::set<size_t> odd_neighbors = {1, 2, 4, 6, 9, 10};
+      for (size_t i = 0; i < 100; i++) {
+        REQUIRE(even_neighbors.count(kernel.Disperse(9, 4, 4, true, random)) == 1);
+        REQUIRE(odd_neighbors.count(kernel.Disperse(5, 4, 4, true, random)) == 1);
+      }
+    }
+  }
+
+  WHEN("the settings are invalid"){
+    THEN("building the kernel throws"){
+      REQUIRE_THROWS(kernel.Build("gaussian", 1, 1, 3));
+      REQUIRE_THROWS(kernel.Build("exponential", 0, 1, 3));
+      REQUIRE_THROWS(kernel.Build("power_law", 1, 1, 0));
+    }
+  }
+}
+
+TEST_CASE("SymWorld dispersal kernels", "[default]"){
+  emp::Random random(31);
+  SymConfigBase config;
+  config.GRID(1);
+  config.DISPERSAL_KERNEL("exponential");
+  config.DISPERSAL_SCALE(3);
+  config.DISPERSAL_MAX_DIST(4);
+  SymWorld world(random, &config);
+  world.SetPopStruct_Grid(20, 20, false);
+  world.Resize(20, 20);
+
+  WHEN("a host reproduces"){
+    size_t parent_pos = 210;
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), parent_pos);
+    emp::Ptr<Organism> host_baby = world.GetOrgPtr(parent_pos)->Reproduce();
+    emp::WorldPosition pos = world.DoBirth(host_baby, parent_pos);
+    THEN("its offspring lands within the kernel's reach"){
+      REQUIRE(pos.IsValid());
+      REQUIRE(world.GetPop()[pos.GetIndex()] == host_baby);
+      int dx = (int) (pos.GetIndex() % 20) - 10, dy = (int) (pos.GetIndex() / 20) - 10;
+      REQUIRE(dx * dx + dy * dy <= 16);
+    }
+  }
+
+  WHEN("a free-living symbiont moves"){
+    emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+    emp::WorldPosition pos = world.MoveIntoNewFreeWorldPos(sym, emp::WorldPosition(0, 210));
+    THEN("it lands within the kernel's reach"){
+      REQUIRE(pos.IsValid());
+      REQUIRE(world.GetSymAt(pos.GetPopID()) == sym);
+      int dx = (int) (pos.GetPopID() % 20) - 10, dy = (int) (pos.GetPopID() / 20) - 10;
+      REQUIRE(dx * dx + dy * dy <= 16);
+      REQUIRE(dx * dx + dy * dy > 0);
+    }
+  }
+}
+
+TEST_CASE("SymWorld rejects an invalid dispersal kernel", "[default]"){
+  emp::Random random(37);
+  SymConfigBase config;
+  config.DISPERSAL_KERNEL("gaussian");
+
+  WHEN("the world is not a grid"){
+    THEN("creating it throws"){
+      REQUIRE_THROWS(SymWorld(random, &config));
+    }
+  }
+}
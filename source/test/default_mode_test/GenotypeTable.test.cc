@@ -0,0 +1,97 @@
+#include "../../default_mode/GenotypeTable.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+TEST_CASE("GenotypeTable counts", "[default]"){
+  GenotypeTable table;
+  Genotype a;
+  a.int_val = 0.5;
+  Genotype b = a;
+  b.infection_chance = 0.1;
+
+  GIVEN("organisms added with two genotypes"){
+    emp::Ptr<const Genotype> a1 = table.Add(a);
+    emp::Ptr<const Genotype> a2 = table.Add(a);
+    emp::Ptr<const Genotype> b1 = table.Add(b);
+
+    THEN("identical traits share one entry"){
+      REQUIRE(a1 == a2);
+      REQUIRE(a1 != b1);
+      REQUIRE(*a1 == a);
+      REQUIRE(table.GetNumGenotypes() == 2);
+      REQUIRE(table.GetNumOrgs() == 3);
+      REQUIRE(table.GetCount(a1) == 2);
+      REQUIRE(table.GetDominant() == a1);
+      REQUIRE(table.GetDominantCount() == 2);
+      REQUIRE(table.Find(b) == b1);
+    }
+
+    WHEN("the last organism of a genotype is removed"){
+      table.Remove(b);
+      THEN("its entry is removed"){
+        REQUIRE(table.GetNumGenotypes() == 1);
+        REQUIRE(table.GetNumOrgs() == 2);
+      }
+    }
+
+    WHEN("every organism is removed"){
+      table.Remove(a);
+      table.Remove(a);
+      table.Remove(b);
+      THEN("the table is empty"){
+        REQUIRE(table.GetNumGenotypes() == 0);
+        REQUIRE(table.GetDominant() == nullptr);
+        REQUIRE(table.GetDominantCount() == 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("SymWorld genotype tables", "[default]"){
+  emp::Random random(19);
+  SymConfigBase config;
+  config.GENOTYPE_TABLE(1);
+  config.MUTATION_RATE(0);
+  config.MUTATION_SIZE(0);
+  SymWorld world(random, &config);
+  world.Resize(4);
+
+  GIVEN("hosts placed in the world and symbionts born without mutation"){
+    for (size_t i = 0; i < 3; i++) world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.2), i);
+    emp::Ptr<Organism> parent = emp::NewPtr<Symbiont>(&random, &world, &config, -0.3);
+    emp::Ptr<Organism> child = parent->Reproduce();
+    world.GetOrgPtr(0)->AddSymbiont(child);
+
+    THEN("clones share one entry"){
+      emp::Ptr<GenotypeTable> hosts = world.GetHostGenotypes();
+      emp::Ptr<GenotypeTable> syms = world.GetSymGenotypes();
+      REQUIRE(hosts->GetNumGenotypes() == 1);
+      REQUIRE(hosts->GetNumOrgs() == 3);
+      REQUIRE(hosts->GetDominant()->int_val == 0.2);
+      REQUIRE(world.GetGenotype(world.GetOrgPtr(1)) == hosts->GetDominant());
+      REQUIRE(syms->GetNumOrgs() == 1);
+      REQUIRE(world.GetGenotype(child)->int_val == -0.3);
+      REQUIRE(world.GetGenotype(child)->infection_chance == child->GetInfectionChance());
+      REQUIRE(world.GetGenotype(parent) == nullptr);
+    }
+
+    WHEN("a host dies"){
+      world.RemoveOrgAt(0);
+      THEN("it and its symbiont leave the tables"){
+        REQUIRE(world.GetHostGenotypes()->GetNumOrgs() == 2);
+        REQUIRE(world.GetSymGenotypes()->GetNumOrgs() == 0);
+        REQUIRE(world.GetSymGenotypes()->GetNumGenotypes() == 0);
+      }
+    }
+
+    WHEN("a host is replaced by a host with another genotype"){
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, -0.6), 1);
+      THEN("both genotypes are counted"){
+        REQUIRE(world.GetHostGenotypes()->GetNumGenotypes() == 2);
+        REQUIRE(world.GetHostGenotypes()->GetNumOrgs() == 3);
+        REQUIRE(world.GetHostGenotypes()->GetDominantCount() == 2);
+      }
+    }
+    parent.Delete();
+  }
+}
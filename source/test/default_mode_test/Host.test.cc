@@ -61,7 +61,7 @@ TEST_CASE("Host SetIntVal, GetIntVal", "[default]") {
     int_val = -0.7;
     host2->SetIntVal(int_val);
     expected_int_val = -0.7;
-    REQUIRE(host2->GetIntVal() == expected_int_val);
+    REQUIRE(host2->GetIntVal() == StoredTrait(expected_int_val));
 
     int_val = -1.3;
     REQUIRE_THROWS(emp::NewPtr<Host>(random, &world, &config, int_val));
@@ -132,9 +132,9 @@ TEST_CASE("Host Mutate", "[default]") {
         config.MUTATION_RATE(1);
         emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, int_val);
 
-        REQUIRE(host->GetIntVal() == int_val);
+        REQUIRE(host->GetIntVal() == StoredTrait(int_val));
         host->Mutate();
-        REQUIRE(host->GetIntVal() != int_val);
+        REQUIRE(host->GetIntVal() != StoredTrait(int_val));
         REQUIRE(host->GetIntVal() <= 1);
         REQUIRE(host->GetIntVal() >= -1);
 
@@ -146,9 +146,9 @@ TEST_CASE("Host Mutate", "[default]") {
         config.HOST_MUTATION_RATE(1);
         config.MUTATION_RATE(0);
         emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, int_val);
-        REQUIRE(host->GetIntVal() == int_val);
+        REQUIRE(host->GetIntVal() == StoredTrait(int_val));
         host->Mutate();
-        REQUIRE(host->GetIntVal() != int_val);
+        REQUIRE(host->GetIntVal() != StoredTrait(int_val));
         REQUIRE(host->GetIntVal() <= 1);
         REQUIRE(host->GetIntVal() >= -1);
 
@@ -162,9 +162,9 @@ TEST_CASE("Host Mutate", "[default]") {
         config.HOST_MUTATION_SIZE(-1);
         config.MUTATION_RATE(1);
         emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, int_val);
-        REQUIRE(host->GetIntVal() == int_val);
+        REQUIRE(host->GetIntVal() == StoredTrait(int_val));
         host->Mutate();
-        REQUIRE(host->GetIntVal() != int_val);
+        REQUIRE(host->GetIntVal() != StoredTrait(int_val));
         REQUIRE(host->GetIntVal() <= 1);
         REQUIRE(host->GetIntVal() >= -1);
 
@@ -176,9 +176,9 @@ TEST_CASE("Host Mutate", "[default]") {
         config.HOST_MUTATION_SIZE(1);
         config.MUTATION_SIZE(0);
         emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, int_val);
-        REQUIRE(host->GetIntVal() == int_val);
+        REQUIRE(host->GetIntVal() == StoredTrait(int_val));
         host->Mutate();
-        REQUIRE(host->GetIntVal() != int_val);
+        REQUIRE(host->GetIntVal() != StoredTrait(int_val));
         REQUIRE(host->GetIntVal() <= 1);
         REQUIRE(host->GetIntVal() >= -1);
 
@@ -205,7 +205,7 @@ TEST_CASE("DistributeResources", "[default]") {
         THEN("Points increase") {
             double expected_points = resources - (resources * int_val); // 48
             double points = host->GetPoints();
-            REQUIRE(points == expected_points);
+            REQUIRE(points == TraitApprox(expected_points, resources));
             REQUIRE(points > orig_points);
         }
 
@@ -247,7 +247,7 @@ TEST_CASE("DistributeResources", "[default]") {
             double add_points  = resources - host_defense;
             double expected_points = orig_points + add_points;
             double points = host->GetPoints();
-            REQUIRE(points == expected_points);
+            REQUIRE(points == TraitApprox(expected_points, resources));
             REQUIRE(points > orig_points);
         }
 
@@ -305,8 +305,8 @@ TEST_CASE("Steal resources unit test", "[default]"){
             double expected_res_in_process = 60; // res_in_process - expected_stolen
 
             THEN("Amount stolen is dependent on both sym_int_val and host_int_val"){
-                REQUIRE(host->StealResources(sym_int_val) == expected_stolen);
-                REQUIRE(host->GetResInProcess() == expected_res_in_process);
+                REQUIRE(host->StealResources(sym_int_val) == TraitApprox(expected_stolen, 100));
+                REQUIRE(host->GetResInProcess() == TraitApprox(expected_res_in_process, 100));
             }
             host.Delete();
         }
@@ -485,7 +485,7 @@ TEST_CASE("AddSymbiont", "[default]"){
 
   WHEN("A symbiont successfully infects"){
     size_t pos = host->AddSymbiont(symbiont);
-    emp::vector<emp::Ptr<Organism>>& host_syms = host->GetSymbionts();
+    SymList& host_syms = host->GetSymbionts();
     THEN("It is added to the host sym vector and it's position is returned"){
       REQUIRE(host->HasSym() == true);
       REQUIRE(pos == host_syms.size());
@@ -502,3 +502,38 @@ TEST_CASE("AddSymbiont", "[default]"){
   }
   host.Delete();
 }
+
+TEST_CASE("Host Process removes dead symbionts", "[default]"){
+  emp::Ptr<emp::Random> random = new emp::Random(-1);
+  SymConfigBase config;
+  config.SYM_LIMIT(3);
+  config.HORIZ_TRANS(0);
+  SymWorld world(*random, &config);
+  double int_val = 0;
+  emp::Ptr<Host> host = emp::NewPtr<Host>(random, &world, &config, int_val);
+  emp::vector<emp::Ptr<Organism>> syms;
+  for (size_t i = 0; i < 3; i++) {
+    syms.push_back(emp::NewPtr<Symbiont>(random, &world, &config, int_val));
+    host->AddSymbiont(syms[i]);
+  }
+  syms[0]->SetDead();
+
+  WHEN("SYM_SWAP_REMOVE is off"){
+    host->Process(emp::WorldPosition(0));
+    THEN("the other symbionts keep their order"){
+      emp::vector<emp::Ptr<Organism>> expected = {syms[1], syms[2]};
+      REQUIRE(host->GetSymbionts() == expected);
+    }
+  }
+  WHEN("SYM_SWAP_REMOVE is on"){
+    config.SYM_SWAP_REMOVE(1);
+    host->Process(emp::WorldPosition(0));
+    THEN("the last symbiont takes the dead one's place and is still processed"){
+      emp::vector<emp::Ptr<Organism>> expected = {syms[2], syms[1]};
+      REQUIRE(host->GetSymbionts() == expected);
+      REQUIRE(syms[2]->GetAge() == 1);
+      REQUIRE(syms[1]->GetAge() == 1);
+    }
+  }
+  host.Delete();
+}
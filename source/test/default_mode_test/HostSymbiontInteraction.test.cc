@@ -13,7 +13,7 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
     double host_resource = 100;
     Host host(&random, &world, &config, host_interaction_val, {}, {}, host_points);
 
-    REQUIRE( host.GetIntVal() == .5 );
+    REQUIRE( host.GetIntVal() == StoredTrait(.5) );
     REQUIRE( host.GetSymbionts().size() == 0 );
     REQUIRE( host.GetReproSymbionts().size() == 0 );
     REQUIRE( host.GetPoints() == host_points );
@@ -23,7 +23,7 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
 
       THEN( "the host receives all resources" ) {
         double host_points_theor = host_resource - (host_resource * host_interaction_val) + host_points;
-        REQUIRE( host.GetPoints() == Approx(host_points_theor) );
+        REQUIRE( host.GetPoints() == Approx(host_points_theor).margin(1000 * TRAIT_ROUNDING) );
       }
     }
 
@@ -35,21 +35,21 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
 
       THEN( "the host gains that symbiont" ) {
         REQUIRE( host.GetSymbionts().size() == 1 );
-        REQUIRE( host.GetSymbionts()[0]->GetIntVal() == .6 );
+        REQUIRE( host.GetSymbionts()[0]->GetIntVal() == StoredTrait(.6) );
       }
       THEN( "the host receives more resources than without the symbiont" ) {
         REQUIRE( host.GetPoints() > 117 );
-        REQUIRE( host.GetPoints() == Approx(217) );
+        REQUIRE( host.GetPoints() == Approx(217).margin(1000 * TRAIT_ROUNDING) );
       }
       THEN( "the symbiont receives resources without any bonus") {
         REQUIRE( host.GetSymbionts()[0]->GetPoints() > 203 );
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(223) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(223).margin(1000 * TRAIT_ROUNDING) );
       }
       THEN( "conservation of resources is not in place" ) {
         REQUIRE( (host.GetPoints()-17)+(host.GetSymbionts()[0]->GetPoints()-203) > 100 );
       }
       THEN( "bonus is applied to returned resources" ) {
-        REQUIRE( (host.GetPoints()-17)+(host.GetSymbionts()[0]->GetPoints()-203) - 100 == Approx(100*.5*.6*(5-1)) );
+        REQUIRE( (host.GetPoints()-17)+(host.GetSymbionts()[0]->GetPoints()-203) - 100 == Approx(100*.5*.6*(5-1)).margin(1000 * TRAIT_ROUNDING) );
       }
     }
 
@@ -62,18 +62,18 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
 
       THEN( "the host gains that symbiont" ) {
         REQUIRE( host.GetSymbionts().size() == 1 );
-        REQUIRE( host.GetSymbionts()[0]->GetIntVal() == -.65 );
+        REQUIRE( host.GetSymbionts()[0]->GetIntVal() == StoredTrait(-.65) );
       }
       THEN( "the host receives less than a quarter of the resources" ) {
         REQUIRE( host.GetPoints() < 17+25 );
-        REQUIRE( host.GetPoints() == Approx(36.775) );
+        REQUIRE( host.GetPoints() == Approx(36.775).margin(1000 * TRAIT_ROUNDING) );
       }
       THEN( "the symbiont receives resources" ) {
         REQUIRE( host.GetSymbionts()[0]->GetPoints() > 101 );
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(194.225) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(194.225).margin(1000 * TRAIT_ROUNDING) );
       }
       THEN( "the conservation of resources is in place" ) {
-        REQUIRE( host.GetPoints() + host.GetSymbionts()[0]->GetPoints() == Approx(17 + 101 + 113) );
+        REQUIRE( host.GetPoints() + host.GetSymbionts()[0]->GetPoints() == Approx(17 + 101 + 113).margin(1000 * TRAIT_ROUNDING) );
       }
     }
 
@@ -123,11 +123,11 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
 
       THEN( "the host gains that repro symbiont" ) {
         REQUIRE( host.GetReproSymbionts().size() == 1 );
-        REQUIRE( host.GetReproSymbionts()[0]->GetIntVal() == -.7 );
+        REQUIRE( host.GetReproSymbionts()[0]->GetIntVal() == StoredTrait(-.7) );
         REQUIRE( host.GetReproSymbionts()[0]->GetPoints() == 37 );
       }
       THEN( "the host receives all resources" ) {
-        REQUIRE( host.GetPoints() == Approx(23.5) );
+        REQUIRE( host.GetPoints() == Approx(23.5).margin(1000 * TRAIT_ROUNDING) );
       }
     }
   }
@@ -139,7 +139,7 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
     SymWorld world(random, &config);
     Host host(&random, &world, &config, -.2);
 
-    REQUIRE( host.GetIntVal() == -.2 );
+    REQUIRE( host.GetIntVal() == StoredTrait(-.2) );
     REQUIRE( host.GetSymbionts().size() == 0 );
     REQUIRE( host.GetReproSymbionts().size() == 0 );
     REQUIRE( host.GetPoints() == 0 );
@@ -149,7 +149,7 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
 
       THEN( "the host does not receive all resources" ) {
         REQUIRE( host.GetPoints() < 1 );
-        REQUIRE( host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
     }
 
@@ -160,13 +160,13 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
       host.DistribResources(1);
 
       THEN( "the host receives some resources" ) {
-        REQUIRE( host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "the symbiont does not receive any resources" ) {
         REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(0) );
       }
       THEN( "with the exception of resources spent on defense, resources are conserved" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
     }
 
@@ -177,13 +177,13 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
       host.DistribResources(1);
 
       THEN( "the host receives some resources" ) {
-        REQUIRE( host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "the symbiont does not recieve any resources" ) {
         REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(0) );
       }
       THEN( "with the exception of resources spent on defense, resources are conserved" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
     }
 
@@ -194,13 +194,13 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
       host.DistribResources(1);
 
       THEN( "the host receives fewer resources" ) {
-        REQUIRE( host.GetPoints() == Approx(.8*.7) );
+        REQUIRE( host.GetPoints() == Approx(.8*.7).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "the symbiont receives resources" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(.8*.3) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(.8*.3).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "with the exception of resources spent on defense, resources are conserved" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
     }
 
@@ -211,13 +211,13 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
       host.DistribResources(1);
 
       THEN( "the host receives very few resources" ) {
-        REQUIRE( host.GetPoints() == Approx(.8*.2) );
+        REQUIRE( host.GetPoints() == Approx(.8*.2).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "the symbiont receives some resources" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(.8*.8) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(.8*.8).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "with the exception of resources spent on defense, resources are conserved" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
     }
 
@@ -242,7 +242,7 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
       host.DistribResources(1);
 
       THEN( "the host receives the right amount of resources" ) {
-        REQUIRE( host.GetPoints() == Approx(.8*(1+1+.47)/3) );
+        REQUIRE( host.GetPoints() == Approx(.8*(1+1+.47)/3).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "the nice symbiont receives nothing" ) {
         REQUIRE( host.GetSymbionts()[0]->GetPoints() == Approx(0) );
@@ -251,10 +251,10 @@ TEST_CASE( "Host-Symbiont interactions", "[default]") {
         REQUIRE( host.GetSymbionts()[1]->GetPoints() == Approx(0) );
       }
       THEN( "the hostile symbiont receives a bit" ) {
-        REQUIRE( host.GetSymbionts()[2]->GetPoints() == Approx(.8*.53/3) );
+        REQUIRE( host.GetSymbionts()[2]->GetPoints() == Approx(.8*.53/3).margin(10 * TRAIT_ROUNDING) );
       }
       THEN( "with the exception of resources spent on defense, resources are conserved" ) {
-        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetSymbionts()[1]->GetPoints() + host.GetSymbionts()[2]->GetPoints() + host.GetPoints() == Approx(.8) );
+        REQUIRE( host.GetSymbionts()[0]->GetPoints() + host.GetSymbionts()[1]->GetPoints() + host.GetSymbionts()[2]->GetPoints() + host.GetPoints() == Approx(.8).margin(10 * TRAIT_ROUNDING) );
       }
     }
   }
@@ -186,9 +186,9 @@ TEST_CASE("Host DistribResources", "[default]") {
         THEN("Host and Symbionts points increase") {
 
             for( emp::Ptr<Organism> symbiont : syms) {
-                REQUIRE(symbiont->GetPoints() == sym_points);
+                REQUIRE(symbiont->GetPoints() == TraitApprox(sym_points, 10 * resources));
             }
-            REQUIRE(host->GetPoints() == host_points);
+            REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
         }
         host.Delete();
     }
@@ -224,7 +224,7 @@ TEST_CASE("Host DistribResources", "[default]") {
                 for( emp::Ptr<Organism> symbiont : syms) {
                     REQUIRE(symbiont->GetPoints() == sym_orig_points);
                 }
-                REQUIRE(host->GetPoints() == host_points);
+                REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
                 REQUIRE(host->GetPoints() > host_orig_points);
             }
             host.Delete();
@@ -258,10 +258,10 @@ TEST_CASE("Host DistribResources", "[default]") {
 
             THEN("Symbionts points and Host points increase") {
                 for( emp::Ptr<Organism> symbiont : syms) {
-                    REQUIRE(symbiont->GetPoints() == sym_points);
+                    REQUIRE(symbiont->GetPoints() == TraitApprox(sym_points, 10 * resources));
                     REQUIRE(symbiont->GetPoints() > sym_orig_points);
                 }
-                REQUIRE(host->GetPoints() == host_points);
+                REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
                 REQUIRE(host->GetPoints() > host_orig_points);
             }
             host.Delete();
@@ -287,8 +287,8 @@ TEST_CASE("Host DistribResources", "[default]") {
         host_portion = host_portion - sym_steals; //remove stolen resources from host's portion
 
         THEN("Symbionts points and Host points increase the correct amounts") {
-            REQUIRE(symbiont->GetPoints() == sym_orig_points+sym_portion);
-            REQUIRE(host->GetPoints() == host_orig_points+host_portion);
+            REQUIRE(symbiont->GetPoints() == TraitApprox(sym_orig_points+sym_portion, 10 * resources));
+            REQUIRE(host->GetPoints() == TraitApprox(host_orig_points+host_portion, 10 * resources));
         }
         host.Delete();
     }
@@ -327,11 +327,11 @@ TEST_CASE("Host DistribResources", "[default]") {
            for( emp::Ptr<Organism> symbiont : syms) {
 
 
-               REQUIRE(symbiont->GetPoints() == sym_portion);
+               REQUIRE(symbiont->GetPoints() == TraitApprox(sym_portion, 10 * resources));
                REQUIRE(symbiont->GetPoints() > sym_orig_points);
             }
 
-            REQUIRE(host->GetPoints() == host_final_portion);
+            REQUIRE(host->GetPoints() == TraitApprox(host_final_portion, 10 * resources));
             REQUIRE(host->GetPoints() > host_orig_points);
         }
         host.Delete();
@@ -370,7 +370,7 @@ TEST_CASE("Host DistribResources", "[default]") {
                 REQUIRE(symbiont->GetPoints() == sym_points);
                 REQUIRE(symbiont->GetPoints() == symbiont_orig_points);
             }
-            REQUIRE(host->GetPoints() == host_points);
+            REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
             REQUIRE(host->GetPoints() > host_orig_points);
 
         }
@@ -487,7 +487,7 @@ TEST_CASE("HandleEctosymbiosis"){
 
     THEN("Parallel organisms don't distribute resources together"){
       REQUIRE(sym->GetPoints() == sym_res);
-      REQUIRE(host->GetPoints() == host_res);
+      REQUIRE(host->GetPoints() == TraitApprox(host_res, 10 * res));
       REQUIRE(leftover_res == res);
     }
   }
@@ -513,8 +513,8 @@ TEST_CASE("HandleEctosymbiosis"){
       double leftover_res = host->HandleEctosymbiosis(res, 0);
 
       THEN("Ecto symbiont benefits fully"){
-        REQUIRE(sym->GetPoints() == sym_res);
-        REQUIRE(host->GetPoints() == host_res);
+        REQUIRE(sym->GetPoints() == TraitApprox(sym_res, 10 * res));
+        REQUIRE(host->GetPoints() == TraitApprox(host_res, 10 * res));
         REQUIRE(leftover_res == 0);
       }
     }
@@ -547,9 +547,9 @@ TEST_CASE("HandleEctosymbiosis"){
       host->DistribResources(leftover_res);
 
       THEN("Both symbionts get the same amount of resources"){
-        REQUIRE(hosted_sym->GetPoints() == sym_res);
-        REQUIRE(parallel_sym->GetPoints() == sym_res);
-        REQUIRE(host->GetPoints() == host_res);
+        REQUIRE(hosted_sym->GetPoints() == TraitApprox(sym_res, 10 * res));
+        REQUIRE(parallel_sym->GetPoints() == TraitApprox(sym_res, 10 * res));
+        REQUIRE(host->GetPoints() == TraitApprox(host_res, 10 * res));
         REQUIRE(leftover_res == (res/2)); //resources are split between two syms
       }
     }
@@ -579,9 +579,9 @@ TEST_CASE("HandleEctosymbiosis"){
       host->DistribResources(leftover_res);
 
       THEN("The parallel symbiont does not recieve resources"){
-        REQUIRE(hosted_sym->GetPoints() == hosted_sym_res);
+        REQUIRE(hosted_sym->GetPoints() == TraitApprox(hosted_sym_res, 10 * res));
         REQUIRE(parallel_sym->GetPoints() == 0);
-        REQUIRE(host->GetPoints() == host_res);
+        REQUIRE(host->GetPoints() == TraitApprox(host_res, 10 * res));
         REQUIRE(leftover_res == res); //ectosymbiosis doesn't happen
       }
     }
@@ -601,7 +601,7 @@ TEST_CASE("HandleEctosymbiosis"){
       host->DistribResources(leftover_res);
 
       THEN("The host does not get a sym modifier on its resources"){
-        REQUIRE(host->GetPoints() == host_res);
+        REQUIRE(host->GetPoints() == TraitApprox(host_res, 10 * res));
         REQUIRE(leftover_res == res);
       }
     }
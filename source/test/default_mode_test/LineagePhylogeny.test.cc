@@ -0,0 +1,144 @@
+#include "../../default_mode/LineagePhylogeny.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+TEST_CASE("LineagePhylogeny genotypes and pruning", "[default]"){
+  GIVEN("a lineage phylogeny"){
+    LineagePhylogeny phylo;
+    size_t none = LineagePhylogeny::NO_NODE;
+
+    WHEN("offspring with and without mutations are born"){
+      size_t root = phylo.AddOrg(0.5, none, 0);
+      size_t same = phylo.AddOrg(0.5, root, 1);
+      size_t mutant = phylo.AddOrg(0.25, root, 2);
+      size_t grandchild = phylo.AddOrg(-0.1, mutant, 3);
+
+      THEN("only mutations create new nodes"){
+        REQUIRE(same == root);
+        REQUIRE(phylo.GetNumNodes() == 3);
+        REQUIRE(phylo.GetNumOrgs(root) == 2);
+        REQUIRE(phylo.GetParent(mutant) == root);
+        REQUIRE(phylo.GetParent(grandchild) == mutant);
+        REQUIRE(phylo.GetParent(root) == none);
+        REQUIRE(phylo.GetOriginationTime(mutant) == 2);
+        REQUIRE(phylo.GetTrait(grandchild) == Approx(-0.1));
+      }
+
+      WHEN("an intermediate genotype dies out but has living descendants"){
+        phylo.RemoveOrg(mutant, 4);
+        size_t num_pruned = phylo.Prune();
+        THEN("it is kept, with the update it died out"){
+          REQUIRE(num_pruned == 0);
+          REQUIRE(phylo.GetNumNodes() == 3);
+          REQUIRE(phylo.GetDestructionTime(mutant) == 4);
+          REQUIRE(phylo.GetDestructionTime(grandchild) == none);
+        }
+      }
+
+      WHEN("a lineage dies out"){
+        phylo.RemoveOrg(mutant, 4);
+        phylo.RemoveOrg(grandchild, 4);
+        size_t num_pruned = phylo.Prune();
+        THEN("its nodes are pruned and their slots reused"){
+          REQUIRE(num_pruned == 2);
+          REQUIRE(phylo.GetNumNodes() == 1);
+          size_t new_node = phylo.AddOrg(0.9, root, 5);
+          REQUIRE(phylo.GetCapacity() == 3);
+          REQUIRE((new_node == mutant || new_node == grandchild));
+          REQUIRE(phylo.GetParent(new_node) == root);
+        }
+      }
+    }
+
+    WHEN("organisms are tracked by position"){
+      phylo.AddOrgAt(0, 0.5, none, 0);
+      phylo.AddOrgAt(1, 0.1, phylo.GetNodeAt(0), 1);
+      phylo.AddOrgAt(1, 0.2, phylo.GetNodeAt(0), 2);
+      THEN("placing an organism over another removes the old one"){
+        REQUIRE(phylo.Prune() == 1);
+        REQUIRE(phylo.GetNumNodes() == 2);
+        REQUIRE(phylo.GetTrait(phylo.GetNodeAt(1)) == Approx(0.2));
+      }
+    }
+  }
+}
+
+TEST_CASE("Lineage phylogeny tracking in SymWorld", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.MUTATION_SIZE(0.09);
+  config.MUTATION_RATE(1);
+  config.PHYLOGENY(1);
+  config.PHYLOGENY_TRACKER("lineage");
+  config.FREE_LIVING_SYMS(1);
+  SymWorld world(random, &config);
+  world.Resize(10);
+
+  emp::Ptr<LineagePhylogeny> host_phylo = world.GetHostLineageSys();
+  emp::Ptr<LineagePhylogeny> sym_phylo = world.GetSymLineageSys();
+  REQUIRE(world.GetHostSys() == nullptr);
+  REQUIRE(world.GetSymBinSys() == nullptr);
+
+  WHEN("hosts are born from a parent"){
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 0);
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.3), 1, 0);
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 2, 0);
+
+    THEN("the tree records genotypes and their parents"){
+      REQUIRE(host_phylo->GetNumNodes() == 2);
+      REQUIRE(host_phylo->GetNodeAt(2) == host_phylo->GetNodeAt(0));
+      REQUIRE(host_phylo->GetParent(host_phylo->GetNodeAt(1)) == host_phylo->GetNodeAt(0));
+    }
+
+    world.DoDeath(1);
+    THEN("extinct genotypes are pruned"){
+      REQUIRE(host_phylo->Prune() == 1);
+    }
+  }
+
+  WHEN("symbionts reproduce"){
+    emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+    world.AddSymToSystematic(sym);
+    emp::Ptr<Organism> sym_baby = sym->Reproduce();
+
+    THEN("the offspring's genotype descends from the parent's"){
+      REQUIRE(sym_phylo->GetParent(sym_baby->GetPhyloID()) == sym->GetPhyloID());
+      REQUIRE(sym_phylo->GetTrait(sym_baby->GetPhyloID()) == Approx(sym_baby->GetIntVal()));
+    }
+
+    WHEN("the surviving tree is written"){
+      sym.Delete();
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 0);
+      world.WritePhylogenyFile("lineage_phylo_test.data");
+      std::ifstream in("SymSnapshot_lineage_phylo_test.data");
+      std::string header, line;
+      std::getline(in, header);
+      size_t num_rows = 0;
+      while (std::getline(in, line)) num_rows++;
+
+      THEN("it holds the offspring and its extinct ancestor"){
+        REQUIRE(header == "id,ancestor_list,origin_time,destruction_time,num_orgs,info");
+        REQUIRE(num_rows == 2);
+      }
+      sym_baby.Delete();
+      std::remove("SymSnapshot_lineage_phylo_test.data");
+      std::remove("HostSnapshot_lineage_phylo_test.data");
+    }
+  }
+}
+
+TEST_CASE("Lineage pruning intervals below one are rejected", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.PHYLOGENY(1);
+  config.PHYLOGENY_TRACKER("lineage");
+  config.PHYLOGENY_PRUNE_INT(0);
+  REQUIRE_THROWS(SymWorld(random, &config));
+
+  config.PHYLOGENY_PRUNE_INT(-5);
+  REQUIRE_THROWS(SymWorld(random, &config));
+
+  config.PHYLOGENY_PRUNE_INT(1);
+  REQUIRE_NOTHROW(SymWorld(random, &config));
+}
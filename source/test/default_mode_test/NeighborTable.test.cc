@@ -0,0 +1,115 @@
+#include "../../default_mode/NeighborTable.h"
+#include "../../default_mode/Host.h"
+
+TEST_CASE("NeighborTable topologies", "[default]"){
+  NeighborTable table;
+
+  WHEN("the grid is a moore torus"){
+    table.Build(5, 4, "moore", 1, true);
+    THEN("every cell has itself and its 8 surrounding cells, row by row"){
+      emp::vector<uint32_t> expected = {0, 1, 2, 5, 6, 7, 10, 11, 12};
+      emp::vector<uint32_t> found(table.GetNeighbors(6).begin(), table.GetNeighbors(6).end());
+      REQUIRE(found == expected);
+      expected = {19, 15, 16, 4, 0, 1, 9, 5, 6};
+      found = emp::vector<uint32_t>(table.GetNeighbors(0).begin(), table.GetNeighbors(0).end());
+      REQUIRE(found == expected);
+    }
+    THEN("random neighbors are drawn as Empirical's grid draws its offsets"){
+      emp::vector<uint32_t> row = {0, 1, 2, 5, 6, 7, 10, 11, 12};
+      emp::Random random(5);
+      emp::Random reference(5);
+      for (size_t i = 0; i < 50; i++) {
+        REQUIRE(table.GetRandomNeighbor(6, random) == row[reference.GetInt(9)]);
+      }
+    }
+  }
+
+  WHEN("the grid is a von neumann torus with radius 2"){
+    table.Build(7, 7, "von_neumann", 2, true);
+    THEN("every cell has the 13 cells within two steps"){
+      REQUIRE(table.GetNeighbors(24).size() == 13);
+      std::set<uint32_t> found(table.GetNeighbors(24).begin(), table.GetNeighbors(24).end());
+      REQUIRE(found.count(10) == 1);
+      REQUIRE(found.count(8) == 0);
+    }
+  }
+
+  WHEN("the grid is hexagonal"){
+    table.Build(4, 4, "hex", 1, true);
+    THEN("cells in even and odd rows have their 6 surrounding cells"){
+      std::set<uint32_t> even(table.GetNeighbors(9).begin(), table.GetNeighbors(9).end());
+      REQUIRE(even == std::set<uint32_t>({4, 5, 8, 9, 10, 12, 13}));
+      std::set<uint32_t> odd(table.GetNeighbors(5).begin(), table.GetNeighbors(5).end());
+      REQUIRE(odd == std::set<uint32_t>({1, 2, 4, 5, 6, 9, 10}));
+    }
+  }
+
+  WHEN("the grid is bounded"){
+    table.Build(5, 4, "moore", 1, false);
+    THEN("cells at the edges have fewer neighbors"){
+      REQUIRE(table.GetNeighbors(0).size() == 4);
+      REQUIRE(table.GetNeighbors(2).size() == 6);
+      REQUIRE(table.GetNeighbors(6).size() == 9);
+      REQUIRE(table.GetNeighbors(19).size() == 4);
+      emp::vector<uint32_t> expected = {13, 14, 18, 19};
+      emp::vector<uint32_t> found(table.GetNeighbors(19).begin(), table.GetNeighbors(19).end());
+      REQUIRE(found == expected);
+    }
+  }
+
+  WHEN("the neighborhood is large"){
+    THEN("a wrapping grid keeps only the offsets of one neighborhood"){
+      table.Build(100, 100, "moore", 3, true);
+      REQUIRE(table.GetNeighbors(0).size() == 49);
+      REQUIRE(table.GetBytes() < 49 * 2 * sizeof(NeighborTable::Offset));
+    }
+    THEN("a bounded grid lists neighbors only near its edges"){
+      table.Build(100, 100, "moore", 3, false);
+      REQUIRE(table.GetNeighbors(5050).size() == 49);
+      REQUIRE(table.GetNeighbors(0).size() == 16);
+      REQUIRE(table.GetBytes() < 100 * 100 * 49 * sizeof(uint32_t) / 4);
+    }
+  }
+
+  WHEN("the settings are invalid"){
+    THEN("building the table throws"){
+      REQUIRE_THROWS(table.Build(4, 4, "triangle", 1, true));
+      REQUIRE_THROWS(table.Build(4, 4, "moore", 0, true));
+      REQUIRE_THROWS(table.Build(4, 3, "hex", 1, true));
+    }
+  }
+}
+
+TEST_CASE("SymWorld grid topologies", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.GRID(1);
+
+  WHEN("hosts are born on a bounded von neumann grid"){
+    config.GRID_TOPOLOGY("von_neumann");
+    config.GRID_WRAP(0);
+    SymWorld world(random, &config);
+    world.SetPopStruct_Grid(10, 10, false);
+    world.Resize(10, 10);
+    THEN("offspring are placed in the parent's neighborhood"){
+      for (size_t i = 0; i < 20; i++) {
+        emp::WorldPosition pos = world.GetRandomNeighborPos(emp::WorldPosition(0));
+        REQUIRE((pos.GetIndex() == 0 || pos.GetIndex() == 1 || pos.GetIndex() == 10));
+      }
+    }
+    THEN("neighboring hosts are found only in the neighborhood"){
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 11);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 1);
+      for (size_t i = 0; i < 20; i++) REQUIRE(world.GetNeighborHost(0).GetIndex() == 1);
+    }
+  }
+
+  WHEN("a grid world is resized"){
+    SymWorld world(random, &config);
+    world.SetPopStruct_Grid(3, 3, false);
+    world.Resize(6, 6);
+    THEN("the neighborhoods are rebuilt"){
+      REQUIRE(world.GetNeighborTable().GetNumCells() == 36);
+    }
+  }
+}
@@ -0,0 +1,45 @@
+#include "../../default_mode/ObjectCensus.h"
+
+namespace {
+  struct CountedBase : public CensusCounter<CountedBase> {};
+  struct CountedChild : public CountedBase, public CensusCounter<CountedChild> {};
+}
+
+TEST_CASE("CensusCounter counts", "[default]"){
+  GIVEN("a counted class and a counted subclass"){
+    size_t base_births = CensusCounter<CountedBase>::GetNumBirths();
+    size_t base_deletions = CensusCounter<CountedBase>::GetNumDeletions();
+    size_t child_births = CensusCounter<CountedChild>::GetNumBirths();
+
+    WHEN("objects are constructed, copied and destroyed"){
+      {
+        CountedBase a;
+        CountedBase b = a;
+        CountedBase c = std::move(b);
+        CountedChild d;
+        REQUIRE(CensusCounter<CountedBase>::GetNumLive() == 4);
+        REQUIRE(CensusCounter<CountedChild>::GetNumLive() == 1);
+        b = c; //assignment creates no object
+        REQUIRE(CensusCounter<CountedBase>::GetNumLive() == 4);
+      }
+
+      THEN("births and deletions match, and a subclass counts under both"){
+        REQUIRE(CensusCounter<CountedBase>::GetNumBirths() == base_births + 4);
+        REQUIRE(CensusCounter<CountedBase>::GetNumDeletions() == base_deletions + 4);
+        REQUIRE(CensusCounter<CountedBase>::GetNumLive() == 0);
+        REQUIRE(CensusCounter<CountedChild>::GetNumBirths() == child_births + 1);
+        REQUIRE(CensusCounter<CountedChild>::GetNumLive() == 0);
+      }
+    }
+
+    THEN("the counter adds nothing to the size of a counted class"){
+      REQUIRE(sizeof(CountedBase) == 1);
+    }
+  }
+
+  THEN("the peak resident memory is measured"){
+#if defined(__linux__) || defined(__APPLE__)
+    REQUIRE(GetPeakMemoryKB() > 0);
+#endif
+  }
+}
@@ -0,0 +1,98 @@
+#include "../../default_mode/PhaseProfiler.h"
+#include <sstream>
+
+TEST_CASE("PhaseProfiler summary and trace", "[default]"){
+  GIVEN("a profiler summarizing every 2 updates"){
+    std::string summary_path = "PhaseProfilerTest_Timing.data";
+    std::string trace_path = "PhaseProfilerTest_Trace.json";
+    {
+      emp::Ptr<PhaseProfiler> profiler = emp::NewPtr<PhaseProfiler>(summary_path, trace_path, 2);
+      for (size_t update = 0; update < 4; update++) {
+        ScopedPhaseTimer update_timer(profiler, PhaseProfiler::UPDATE);
+        ScopedPhaseTimer stats_timer(profiler, PhaseProfiler::STATS);
+        for (size_t cell = 0; cell < 3; cell++) {
+          ScopedPhaseTimer host_timer(profiler, PhaseProfiler::HOST_PROCESS);
+        }
+      }
+      REQUIRE(profiler->GetNumUpdates() == 4);
+
+      WHEN("a timer has no profiler"){
+        ScopedPhaseTimer timer(nullptr, PhaseProfiler::UPDATE);
+        THEN("nothing is recorded"){
+          REQUIRE(profiler->GetNumUpdates() == 4);
+        }
+      }
+      profiler.Delete();
+    }
+
+    THEN("the summary has a header and a row every 2 updates"){
+      std::ifstream summary(summary_path);
+      std::string line;
+      emp::vector<std::string> lines;
+      while (std::getline(summary, line)) lines.push_back(line);
+      REQUIRE(lines.size() == 3);
+      REQUIRE(lines[0] == "update,update_ms,host_process_ms,sym_process_ms,birth_ms,stats_ms,output_ms,systematics_ms,run_ms,no_mut_run_ms");
+      REQUIRE(lines[1].substr(0, 2) == "0,");
+      REQUIRE(lines[2].substr(0, 2) == "2,");
+    }
+
+    THEN("the trace holds a span per coarse phase and a counter per update"){
+      std::ifstream trace(trace_path);
+      std::stringstream contents;
+      contents << trace.rdbuf();
+      std::string json = contents.str();
+      REQUIRE(json.substr(0, 16) == "{\"traceEvents\":[");
+      REQUIRE(json.substr(json.size() - 4) == "\n]}\n");
+
+      size_t spans = 0, counters = 0, host_spans = 0;
+      for (size_t pos = json.find("\"ph\":\"X\""); pos != std::string::npos; pos = json.find("\"ph\":\"X\"", pos + 1)) spans++;
+      for (size_t pos = json.find("\"ph\":\"C\""); pos != std::string::npos; pos = json.find("\"ph\":\"C\"", pos + 1)) counters++;
+      for (size_t pos = json.find("\"name\":\"host_process\""); pos != std::string::npos; pos = json.find("\"name\":\"host_process\"", pos + 1)) host_spans++;
+      REQUIRE(spans == 8);
+      REQUIRE(counters == 4);
+      REQUIRE(host_spans == 0);
+    }
+  }
+}
+
+TEST_CASE("PhaseProfiler hardware counters", "[default]"){
+  GIVEN("a profiler with counters enabled"){
+    std::string counters_path = "PhaseProfilerTest_Counters.data";
+    emp::Ptr<PhaseProfiler> profiler = emp::NewPtr<PhaseProfiler>("PhaseProfilerTest_Timing.data", "PhaseProfilerTest_Trace.json", 1);
+    bool available = profiler->EnableCounters(counters_path);
+    PerfCounters counters;
+    REQUIRE(available == counters.IsAvailable());
+
+    {
+      ScopedPhaseTimer timer(profiler, PhaseProfiler::STATS);
+      volatile double sum = 0;
+      for (size_t i = 0; i < 100000; i++) sum = sum + i;
+    }
+
+    if (available) {
+      THEN("the phase counts instructions and the totals are written"){
+        REQUIRE(profiler->GetCounts(PhaseProfiler::STATS)[1] > 100000);
+        REQUIRE(profiler->GetCounts(PhaseProfiler::UPDATE)[1] == 0);
+        profiler.Delete();
+        profiler = nullptr;
+        std::ifstream file(counters_path);
+        std::string header;
+        std::getline(file, header);
+        REQUIRE(header == "phase,cycles,instructions,cache_misses,branch_misses,ipc");
+      }
+    } else {
+      THEN("nothing is counted and no file is written"){
+        REQUIRE(profiler->GetCounts(PhaseProfiler::STATS)[1] == 0);
+        REQUIRE(counters.Read()[0] == 0);
+        profiler.Delete();
+        profiler = nullptr;
+        std::ifstream file(counters_path);
+        REQUIRE(!file.good());
+      }
+    }
+    if (profiler) profiler.Delete();
+    std::remove(counters_path.c_str());
+    std::remove("PhaseProfilerTest_Timing.data");
+    std::remove("PhaseProfilerTest_Trace.json");
+  }
+}
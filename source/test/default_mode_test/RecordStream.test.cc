@@ -0,0 +1,122 @@
+#include "../../default_mode/RecordStream.h"
+#include "../../default_mode/DataNodes.h"
+#include "../../default_mode/Host.h"
+
+TEST_CASE("RecordStream write and read", "[default]"){
+  GIVEN("a record stream with two series"){
+    std::string stream_name = "RecordStream_test.stream";
+    {
+      RecordStream stream(stream_name);
+      size_t first = stream.AddSeries("first.data");
+      size_t second = stream.AddSeries("second.data");
+      REQUIRE(stream.GetNumSeries() == 2);
+
+      stream.WriteRecord(first, "update,count\n");
+      stream.WriteRecord(second, "update,mean\n");
+      stream.WriteRecord(first, "0,10\n");
+      stream.WriteRecord(second, "0,0.5");
+      stream.WriteRecord(first, "1,11\n");
+      stream.Finalize();
+      REQUIRE(stream.IsFinalized());
+      REQUIRE_THROWS(stream.WriteRecord(first, "2,12\n"));
+    }
+
+    WHEN("the stream is read back"){
+      std::ifstream in(stream_name);
+      std::map<std::string, std::stringstream> series;
+      bool complete = ReadRecordStream(in, series);
+
+      THEN("each series is reproduced in order and the index matches"){
+        REQUIRE(complete);
+        REQUIRE(series.size() == 2);
+        REQUIRE(series["first.data"].str() == "update,count\n0,10\n1,11\n");
+        REQUIRE(series["second.data"].str() == "update,mean\n0,0.5\n");
+      }
+    }
+    std::remove(stream_name.c_str());
+  }
+}
+
+TEST_CASE("Streamed SymDataFile forwards emp::DataFile output", "[default]"){
+  GIVEN("a streamed data file written through emp::DataFile methods"){
+    std::string stream_name = "RecordStream_forward_test.stream";
+    {
+      emp::Ptr<RecordStream> stream = emp::NewPtr<RecordStream>(stream_name);
+      {
+        SymDataFile file(stream, "forward.data");
+        int count = 3;
+        file.AddVar(count, "count", "a count");
+        emp::DataFile & base = file;
+        base.PrintHeaderComment();
+        base.PrintHeaderKeys();
+        base.Update();
+      }
+      stream.Delete();
+    }
+
+    WHEN("the stream is read back"){
+      std::ifstream in(stream_name);
+      std::map<std::string, std::stringstream> series;
+      bool complete = ReadRecordStream(in, series);
+
+      THEN("every line is in the series"){
+        REQUIRE(complete);
+        REQUIRE(series["forward.data"].str() == "# 0: a count (count)\ncount\n3\n");
+      }
+    }
+    std::remove(stream_name.c_str());
+  }
+}
+
+TEST_CASE("SINGLE_DATA_STREAM reproduces the per-file layout", "[default]"){
+  GIVEN("two identical worlds, one writing files and one writing a record stream"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.SEED(17);
+    config.DATA_INT(1);
+    config.FILE_NAME("_stream_test");
+    std::string file_ending = "_stream_test_SEED17.data";
+
+    {
+      SymWorld world(random, &config);
+      world.Resize(4);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 0);
+      world.CreateDateFiles();
+      for (int i = 0; i < 3; i++) world.Update();
+    }
+
+    config.SINGLE_DATA_STREAM(1);
+    {
+      SymWorld world(random, &config);
+      world.Resize(4);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0.5), 0);
+      world.CreateDateFiles();
+      for (int i = 0; i < 3; i++) world.Update();
+    }
+
+    WHEN("the stream is split"){
+      std::ifstream in("DataStream_stream_test_SEED17.stream");
+      std::map<std::string, std::stringstream> series;
+      bool complete = ReadRecordStream(in, series);
+
+      THEN("every series matches the file that was written without the stream"){
+        REQUIRE(complete);
+        REQUIRE(series.size() == 3);
+        for (std::string prefix : {"HostVals", "SymVals", "TransmissionRates"}) {
+          std::string file_name = prefix + file_ending;
+          REQUIRE(series.count(file_name) == 1);
+          std::ifstream file_in(file_name);
+          std::stringstream file_contents;
+          file_contents << file_in.rdbuf();
+          REQUIRE(file_contents.str().size() > 0);
+          REQUIRE(series[file_name].str() == file_contents.str());
+        }
+      }
+    }
+
+    for (std::string prefix : {"HostVals", "SymVals", "TransmissionRates"}) {
+      std::remove((prefix + file_ending).c_str());
+    }
+    std::remove("DataStream_stream_test_SEED17.stream");
+  }
+}
@@ -0,0 +1,140 @@
+#include "../../default_mode/ResourceKernel.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+TEST_CASE("ResourceKernel matches DistribResToSym", "[default]"){
+  emp::Random random(23);
+  SymConfigBase config;
+  SymWorld world(random, &config);
+  emp::vector<double> int_vals = {-1, -0.7, -0.3, -0.1, 0, 0.1, 0.3, 0.7, 1};
+
+  for (double synergy : {5.0, 0.5}) {
+    config.SYNERGY(synergy);
+    for (double host_int_val : int_vals) {
+      for (double sym_int_val : int_vals) {
+        double sym_piece = 37.5;
+        emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, host_int_val);
+        emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, sym_int_val);
+        host->DistribResToSym(sym, sym_piece);
+
+        double host_gain, sym_gain;
+        ResourceKernel::DistribPair(host_int_val, sym_int_val, sym_piece, synergy, host_gain, sym_gain);
+        REQUIRE(host_gain == host->GetPoints());
+        REQUIRE(sym_gain == sym->GetPoints());
+
+        host.Delete();
+        sym.Delete();
+      }
+    }
+  }
+}
+
+TEST_CASE("Host DistribResources with several symbionts", "[default]"){
+  emp::Random random(23);
+  SymConfigBase config;
+  config.SYM_LIMIT(3);
+  SymWorld world(random, &config);
+
+  GIVEN("a host with an antagonistic, a neutral and a mutualistic symbiont"){
+    emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, -0.2);
+    emp::vector<double> sym_int_vals = {-0.8, 0, 0.6};
+    for (double sym_int_val : sym_int_vals) host->AddSymbiont(emp::NewPtr<Symbiont>(&random, &world, &config, sym_int_val));
+    host->DistribResources(90);
+
+    THEN("the points match distributing to each symbiont in order"){
+      emp::Ptr<Host> reference = emp::NewPtr<Host>(&random, &world, &config, -0.2);
+      for (size_t i = 0; i < sym_int_vals.size(); i++) {
+        emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, sym_int_vals[i]);
+        reference->DistribResToSym(sym, 30);
+        REQUIRE(host->GetSymbionts()[i]->GetPoints() == sym->GetPoints());
+        sym.Delete();
+      }
+      REQUIRE(host->GetPoints() == reference->GetPoints());
+      reference.Delete();
+    }
+    host.Delete();
+  }
+}
+
+class KeepingSymbiont : public Symbiont {
+public:
+  using Symbiont::Symbiont;
+  double ProcessResources(double host_donation, emp::Ptr<Organism> host = nullptr) { return 0; }
+};
+
+class OptedInKeepingSymbiont : public KeepingSymbiont {
+public:
+  using KeepingSymbiont::KeepingSymbiont;
+  bool HasDefaultResourceProcessing() { return InheritsProcessResources<OptedInKeepingSymbiont>(); }
+};
+
+class PlainSymbiont : public Symbiont {
+public:
+  using Symbiont::Symbiont;
+};
+
+TEST_CASE("Symbiont HasDefaultResourceProcessing", "[default]"){
+  emp::Random random(23);
+  SymConfigBase config;
+  SymWorld world(random, &config);
+
+  WHEN("the symbiont is a Symbiont"){
+    Symbiont sym(&random, &world, &config, 0.5);
+    THEN("its share is computed with ResourceKernel"){
+      REQUIRE(sym.HasDefaultResourceProcessing());
+    }
+  }
+
+  WHEN("the symbiont's class overrides ProcessResources"){
+    KeepingSymbiont sym(&random, &world, &config, 0.5);
+    THEN("it goes through ProcessResources"){
+      REQUIRE(!sym.HasDefaultResourceProcessing());
+    }
+  }
+
+  WHEN("the symbiont's class opts in but inherits an overridden ProcessResources"){
+    OptedInKeepingSymbiont sym(&random, &world, &config, 0.5);
+    THEN("it goes through ProcessResources"){
+      REQUIRE(!sym.HasDefaultResourceProcessing());
+    }
+  }
+
+  WHEN("the symbiont's class keeps ProcessResources but does not opt in"){
+    PlainSymbiont sym(&random, &world, &config, 0.5);
+    THEN("it goes through ProcessResources"){
+      REQUIRE(!sym.HasDefaultResourceProcessing());
+    }
+  }
+}
+
+TEST_CASE("Symbiont GetPayoff", "[default]"){
+  emp::Random random(23);
+  SymConfigBase config;
+  config.SYNERGY(5);
+  SymWorld world(random, &config);
+  emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, -0.1);
+  emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(&random, &world, &config, -0.4);
+  double host_gain, sym_gain;
+
+  WHEN("the payoff is computed"){
+    sym->GetPayoff(-0.1, 50, 5, host_gain, sym_gain);
+    THEN("it matches distributing the piece through ProcessResources"){
+      host->DistribResToSym(sym, 50);
+      REQUIRE(host_gain == host->GetPoints());
+      REQUIRE(sym_gain == sym->GetPoints());
+    }
+  }
+
+  WHEN("the symbiont's interaction value changes"){
+    sym->GetPayoff(-0.1, 50, 5, host_gain, sym_gain);
+    sym->SetIntVal(0.5);
+    sym->GetPayoff(-0.1, 50, 5, host_gain, sym_gain);
+    THEN("the payoff uses the new value"){
+      host->DistribResToSym(sym, 50);
+      REQUIRE(host_gain == host->GetPoints());
+      REQUIRE(sym_gain == sym->GetPoints());
+    }
+  }
+  host.Delete();
+  sym.Delete();
+}
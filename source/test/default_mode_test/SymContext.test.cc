@@ -0,0 +1,39 @@
+#include "../../default_mode/SymContext.h"
+#include "../../default_mode/SymWorld.h"
+
+TEST_CASE("SymContext sharing", "[default]"){
+  emp::Random random(31);
+  emp::Random other_random(37);
+  SymConfigBase config;
+  SymConfigBase other_config;
+  SymWorld world(random, &config);
+  emp::Ptr<emp::Random> random_ptr = &random;
+  emp::Ptr<SymConfigBase> config_ptr = &config;
+
+  GIVEN("organisms built with the world's random number generator and config"){
+    emp::Ptr<SymContext> context = world.GetContext(random_ptr, config_ptr);
+    THEN("they share the world's context"){
+      REQUIRE(world.GetContext(random_ptr, config_ptr) == context);
+      REQUIRE(context->random == random_ptr);
+      REQUIRE(context->world == emp::Ptr<SymWorld>(&world));
+      REQUIRE(context->config == config_ptr);
+    }
+    THEN("a different config or random number generator gets its own context from the world"){
+      emp::Ptr<SymContext> other = world.GetContext(random_ptr, &other_config);
+      REQUIRE(other != context);
+      REQUIRE(other->config == emp::Ptr<SymConfigBase>(&other_config));
+      REQUIRE(world.GetContext(random_ptr, &other_config) == other);
+      REQUIRE(world.GetContext(&other_random, config_ptr) != context);
+      REQUIRE(world.GetContext(random_ptr, config_ptr) == context);
+    }
+  }
+
+  GIVEN("organisms built for another world"){
+    SymWorld other_world(random, &config);
+    THEN("they use the other world's context"){
+      emp::Ptr<SymContext> other = other_world.GetContext(random_ptr, config_ptr);
+      REQUIRE(other != world.GetContext(random_ptr, config_ptr));
+      REQUIRE(other->world == emp::Ptr<SymWorld>(&other_world));
+    }
+  }
+}
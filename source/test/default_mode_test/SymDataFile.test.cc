@@ -0,0 +1,99 @@
+#include "../../default_mode/SymDataFile.h"
+
+TEST_CASE("SymDataFile delta encoding", "[default]"){
+  GIVEN("a data file with a changing column and two histogram-like columns"){
+    std::stringstream plain_out;
+    std::stringstream delta_out;
+    SymDataFile plain_file(plain_out);
+    SymDataFile delta_file(delta_out);
+    delta_file.SetDeltaEncoding(true);
+
+    int update = 0;
+    int bin_a = 0;
+    int bin_b = 5;
+    for (SymDataFile * file : {&plain_file, &delta_file}) {
+      file->AddVar(update, "update", "Update");
+      file->AddVar(bin_a, "Hist_a", "First bin");
+      file->AddVar(bin_b, "Hist_b", "Second bin");
+      file->PrintHeaderKeys();
+    }
+
+    WHEN("rows are written where the bins rarely change"){
+      for (update = 0; update < 4; update++) {
+        if (update == 2) bin_b = 6;
+        plain_file.Update();
+        delta_file.Update();
+      }
+
+      THEN("unchanged runs are replaced by tokens after the first row"){
+        std::string expected_delta = "update,Hist_a,Hist_b\n0,0,5\n1,~2\n2,~1,6\n3,~2\n";
+        REQUIRE(delta_out.str() == expected_delta);
+      }
+      THEN("decoding reproduces the plain csv exactly"){
+        std::stringstream decoded;
+        size_t num_rows = DecodeDeltaData(delta_out, decoded);
+        REQUIRE(num_rows == 4);
+        REQUIRE(decoded.str() == plain_out.str());
+      }
+      THEN("decoding a plain csv leaves it unchanged"){
+        std::stringstream decoded;
+        DecodeDeltaData(plain_out, decoded);
+        REQUIRE(decoded.str() == plain_out.str());
+      }
+    }
+  }
+}
+
+TEST_CASE("SymDataFile fast formatting", "[default]"){
+  GIVEN("a SymDataFile and an emp::DataFile tracking the same values"){
+    std::stringstream emp_out;
+    std::stringstream sym_out;
+    emp::DataFile emp_file(emp_out);
+    SymDataFile sym_file(sym_out);
+
+    size_t update = 0;
+    int count = 0;
+    double value = 0;
+    bool flag = true;
+    emp::DataMonitor<double, emp::data::Histogram> node;
+    node.SetupBins(-1.0, 1.1, 21);
+
+    emp_file.AddVar(update, "update", "Update");
+    emp_file.AddVar(count, "count", "Count");
+    emp_file.AddVar(value, "value", "Value");
+    emp_file.AddVar(flag, "flag", "Flag");
+    emp_file.AddMean(node, "mean", "Mean");
+    emp_file.AddTotal(node, "total", "Total");
+    emp_file.AddHistBin(node, 10, "Hist_0.0", "Bin", true);
+    emp_file.PrintHeaderKeys();
+
+    sym_file.AddVar(update, "update", "Update");
+    sym_file.AddVar(count, "count", "Count");
+    sym_file.AddVar(value, "value", "Value");
+    sym_file.AddVar(flag, "flag", "Flag");
+    sym_file.AddMean(node, "mean", "Mean");
+    sym_file.AddTotal(node, "total", "Total");
+    sym_file.AddHistBin(node, 10, "Hist_0.0", "Bin", true);
+    sym_file.PrintHeaderKeys();
+
+    WHEN("rows with awkward numbers are written"){
+      emp::vector<double> values = {0.1, -0.123456789, 1.0/3.0, 1234567.0, 1e-7, -0.0, 100000.0, 2.5e12};
+      for (double v : values) {
+        update++;
+        count = (int) update * -37;
+        value = v;
+        flag = !flag;
+        node.AddDatum(v);
+        node.AddDatum(v / 7);
+        emp_file.Update();
+        node.AddDatum(v);
+        node.AddDatum(v / 7);
+        sym_file.Update();
+      }
+
+      THEN("the output is byte-identical"){
+        REQUIRE(sym_out.str() == emp_out.str());
+      }
+    }
+  }
+}
@@ -0,0 +1,119 @@
+#include "../../default_mode/SymList.h"
+#include "../../default_mode/Host.h"
+#include "../../default_mode/Symbiont.h"
+
+TEST_CASE("SymList storage", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  SymWorld world(random, &config);
+  emp::vector<emp::Ptr<Organism>> syms;
+  for (size_t i = 0; i < 5; i++) syms.push_back(emp::NewPtr<Symbiont>(&random, &world, &config, 0));
+
+  GIVEN("a list holding a single symbiont"){
+    SymList list;
+    list.push_back(syms[0]);
+    THEN("it is stored inline, without heap memory"){
+      REQUIRE(list.size() == 1);
+      REQUIRE(list.capacity() == SymList::INLINE_SLOTS);
+      REQUIRE(list.GetHeapBytes() == 0);
+      REQUIRE(list[0] == syms[0]);
+    }
+  }
+
+  GIVEN("a list holding more symbionts than fit inline"){
+    SymList list(syms);
+    THEN("it overflows into a power of two block"){
+      REQUIRE(list == syms);
+      REQUIRE(list.capacity() == 8);
+      REQUIRE(list.GetHeapBytes() == 8 * sizeof(emp::Ptr<Organism>));
+    }
+    WHEN("a symbiont is swap removed"){
+      list.SwapRemove(1);
+      THEN("the last symbiont takes its place"){
+        emp::vector<emp::Ptr<Organism>> expected = {syms[0], syms[4], syms[2], syms[3]};
+        REQUIRE(list == expected);
+      }
+    }
+    WHEN("a symbiont is erased"){
+      list.erase(list.begin() + 1);
+      THEN("the others keep their order"){
+        emp::vector<emp::Ptr<Organism>> expected = {syms[0], syms[2], syms[3], syms[4]};
+        REQUIRE(list == expected);
+      }
+    }
+    WHEN("the list is moved"){
+      SymList moved(std::move(list));
+      THEN("the block moves with it"){
+        REQUIRE(moved == syms);
+        REQUIRE(list.size() == 0);
+        REQUIRE(list.GetHeapBytes() == 0);
+      }
+    }
+    WHEN("the list is cleared"){
+      list.clear();
+      THEN("it goes back to inline storage"){
+        REQUIRE(list.empty());
+        REQUIRE(list.GetHeapBytes() == 0);
+      }
+    }
+    WHEN("the list is converted to a vector"){
+      emp::vector<emp::Ptr<Organism>> copy = list;
+      THEN("the vector holds the same symbionts"){
+        REQUIRE(copy == syms);
+      }
+    }
+  }
+
+  GIVEN("lists that share a pool"){
+    SymListPool pool;
+    SymList list;
+    for (emp::Ptr<Organism> sym : syms) list.push_back(sym, &pool);
+    WHEN("a list is cleared"){
+      list.clear(&pool);
+      THEN("its block goes back to the pool, with the smaller blocks it grew out of"){
+        REQUIRE(list.GetHeapBytes() == 0);
+        REQUIRE(pool.GetNumFree() == 3);
+      }
+      THEN("another list reuses the block"){
+        SymList other;
+        for (emp::Ptr<Organism> sym : syms) other.push_back(sym, &pool);
+        REQUIRE(other == syms);
+        REQUIRE(pool.GetNumFree() == 2);
+        other.clear(&pool);
+      }
+    }
+  }
+
+  for (emp::Ptr<Organism> sym : syms) sym.Delete();
+}
+
+TEST_CASE("Hosts keep their symbionts in order", "[default]"){
+  emp::Random random(17);
+  SymConfigBase config;
+  config.SYM_LIMIT(4);
+  SymWorld world(random, &config);
+  emp::Ptr<Host> host = emp::NewPtr<Host>(&random, &world, &config, 0);
+  emp::vector<emp::Ptr<Organism>> syms;
+  for (size_t i = 0; i < 4; i++) {
+    syms.push_back(emp::NewPtr<Symbiont>(&random, &world, &config, 0));
+    host->AddSymbiont(syms[i]);
+  }
+
+  WHEN("a symbiont dies while the host is processed"){
+    syms[1]->SetDead();
+    world.AddOrgAt(host, 0);
+    host->Process(0);
+    THEN("it is removed and the others keep their order"){
+      emp::vector<emp::Ptr<Organism>> expected = {syms[0], syms[2], syms[3]};
+      REQUIRE(host->GetSymbionts() == expected);
+    }
+  }
+
+  WHEN("the host is deleted"){
+    size_t num_free = world.GetSymListPool().GetNumFree();
+    host.Delete();
+    THEN("its symbiont block goes back to the world's pool"){
+      REQUIRE(world.GetSymListPool().GetNumFree() == num_free + 1);
+    }
+  }
+}
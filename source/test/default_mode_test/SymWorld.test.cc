@@ -1432,3 +1432,207 @@ TEST_CASE( "IsInboundsPos", "[default]" ){
     REQUIRE(world.IsInboundsPos(invalid_pos) == false);
   }
 }
+
+TEST_CASE( "Symbiont deaths during an update are applied to the systematic at its end", "[default]" ){
+  GIVEN("a world with free-living symbionts of the same taxon that are all dead"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.FREE_LIVING_SYMS(1);
+    config.PHYLOGENY(1);
+    config.NUM_PHYLO_BINS(20);
+    int world_size = 4;
+
+    WHEN("the full systematic is used"){
+      SymWorld world(random, &config);
+      world.Resize(world_size);
+      emp::Ptr<emp::Systematics<Organism,int>> sym_sys = world.GetSymSys();
+      emp::Ptr<Organism> parent = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+      world.AddSymToSystematic(parent);
+      for (int i = 0; i < world_size; i++) {
+        emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+        world.AddSymToSystematic(sym, parent->GetTaxon());
+        sym->SetDead();
+        world.AddOrgAt(sym, emp::WorldPosition(0, i));
+      }
+      emp::Ptr<emp::Taxon<int>> taxon = parent->GetTaxon();
+      REQUIRE(taxon->GetNumOrgs() == 5);
+
+      world.Update();
+      THEN("every death is removed from the taxon"){
+        REQUIRE(world.GetNumOrgs() == 0);
+        REQUIRE(taxon->GetNumOrgs() == 1);
+      }
+      parent.Delete();
+      THEN("deaths outside of an update are applied immediately"){
+        REQUIRE(sym_sys->GetNumActive() == 0);
+      }
+    }
+
+    WHEN("the binned tracker is used"){
+      config.PHYLOGENY_TRACKER("binned");
+      SymWorld world(random, &config);
+      world.Resize(world_size);
+      for (int i = 0; i < world_size; i++) {
+        emp::Ptr<Organism> sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0);
+        world.AddSymToSystematic(sym);
+        sym->SetDead();
+        world.AddOrgAt(sym, emp::WorldPosition(0, i));
+      }
+      REQUIRE(world.GetSymBinSys()->GetNumOrgs(10) == 4);
+
+      world.Update();
+      THEN("the deaths are removed together and the bin goes extinct at this update"){
+        REQUIRE(world.GetSymBinSys()->GetNumOrgs(10) == 0);
+        REQUIRE(world.GetSymBinSys()->GetNumActive() == 0);
+        REQUIRE(world.GetSymBinSys()->GetDestructionTime(10) == world.GetUpdate());
+      }
+    }
+  }
+}
+
+TEST_CASE( "Dominant taxa and pairs", "[default]" ){
+  GIVEN("a world with the full phylogeny tracker"){
+    emp::Random random(17);
+    SymConfigBase config;
+    config.PHYLOGENY(1);
+    config.NUM_PHYLO_BINS(20);
+    config.FREE_LIVING_SYMS(1);
+    config.SYM_LIMIT(3);
+    SymWorld world(random, &config);
+    world.Resize(6);
+
+    THEN("there is nothing dominant in an empty world"){
+      REQUIRE(world.GetDominantHostTaxon() == nullptr);
+      REQUIRE(world.GetDominantSymTaxon() == nullptr);
+      REQUIRE(world.GetDominantPair().first == nullptr);
+    }
+
+    WHEN("hosts and symbionts of several taxa are added"){
+      //two hosts in bin 10, one in bin 19
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 0);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 1, 0);
+      world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 1), 2);
+      emp::Ptr<emp::Taxon<int>> host_taxon = world.GetHostSys()->GetTaxonAt(0);
+      emp::Ptr<emp::Taxon<int>> other_host_taxon = world.GetHostSys()->GetTaxonAt(2);
+
+      //a parent symbiont and its unmutated offspring share a taxon
+      emp::Ptr<Organism> sym_parent = emp::NewPtr<Symbiont>(&random, &world, &config, -1);
+      world.AddSymToSystematic(sym_parent);
+      emp::Ptr<emp::Taxon<int>> sym_taxon = sym_parent->GetTaxon();
+      world.GetOrg(2).AddSymbiont(sym_parent);
+      for (int i = 0; i < 2; i++) {
+        emp::Ptr<Organism> sym = sym_parent->Reproduce();
+        world.GetOrg(2).AddSymbiont(sym);
+      }
+      emp::Ptr<Organism> free_sym = emp::NewPtr<Symbiont>(&random, &world, &config, 0.5);
+      world.AddSymToSystematic(free_sym);
+      world.AddOrgAt(free_sym, emp::WorldPosition(0, 3));
+
+      THEN("the dominant taxa and pair are found"){
+        REQUIRE(world.GetDominantHostTaxon() == host_taxon);
+        REQUIRE(world.GetDominantSymTaxon() == sym_taxon);
+        REQUIRE(world.GetDominantFreeHostedSymTaxon()[0] == free_sym->GetTaxon());
+        REQUIRE(world.GetDominantFreeHostedSymTaxon()[1] == sym_taxon);
+        REQUIRE(world.GetDominantPair().first == other_host_taxon);
+        REQUIRE(world.GetDominantPair().second == sym_taxon);
+      }
+
+      WHEN("the host holding the symbionts dies"){
+        world.DoDeath(2);
+        THEN("its symbionts and their pair are no longer counted"){
+          REQUIRE(world.GetDominantSymTaxon() == free_sym->GetTaxon());
+          REQUIRE(world.GetDominantFreeHostedSymTaxon()[1] == nullptr);
+          REQUIRE(world.GetDominantPair().first == nullptr);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("StateDigest", "[default]"){
+  GIVEN("two worlds set up the same way"){
+    SymConfigBase config;
+    config.GRID_X(5);
+    config.GRID_Y(5);
+    config.FREE_LIVING_SYMS(1);
+    config.SYM_LIMIT(2);
+    emp::Random random_a(17);
+    emp::Random random_b(17);
+    SymWorld world_a(random_a, &config);
+    SymWorld world_b(random_b, &config);
+    for (emp::Ptr<SymWorld> world : {emp::Ptr<SymWorld>(&world_a), emp::Ptr<SymWorld>(&world_b)}) {
+      emp::Ptr<emp::Random> random = &world->GetRandom();
+      world->Resize(5, 5);
+      for (size_t i = 0; i < 10; i++) {
+        emp::Ptr<Host> host = emp::NewPtr<Host>(random, world, &config, 0.1 * i);
+        host->AddSymbiont(emp::NewPtr<Symbiont>(random, world, &config, -0.1 * i));
+        world->AddOrgAt(host, i);
+      }
+      world->AddOrgAt(emp::NewPtr<Symbiont>(random, world, &config, 0.5), emp::WorldPosition(0, 20));
+    }
+
+    THEN("they have the same digest before and after running"){
+      REQUIRE(world_a.StateDigest() == world_b.StateDigest());
+      for (size_t i = 0; i < 20; i++) {
+        world_a.Update();
+        world_b.Update();
+        REQUIRE(world_a.StateDigest() == world_b.StateDigest());
+      }
+    }
+
+    THEN("taking a digest does not change the run"){
+      for (size_t i = 0; i < 10; i++) {
+        world_a.StateDigest();
+        world_a.Update();
+        world_b.Update();
+      }
+      REQUIRE(world_a.StateDigest() == world_b.StateDigest());
+    }
+
+    THEN("changing a hosted symbiont's trait changes the digest"){
+      world_b.GetOrg(3).GetSymbionts()[0]->SetIntVal(0.25);
+      REQUIRE(world_a.StateDigest() != world_b.StateDigest());
+    }
+
+    THEN("changing the random number generator's state changes the digest"){
+      random_b.GetDouble();
+      REQUIRE(world_a.StateDigest() != world_b.StateDigest());
+    }
+
+    THEN("moving a free-living symbiont changes the digest"){
+      world_b.AddOrgAt(world_b.ExtractSym(20), emp::WorldPosition(0, 21));
+      REQUIRE(world_a.StateDigest() != world_b.StateDigest());
+    }
+  }
+}
+
+TEST_CASE("GetNeighborHost and world size limit", "[default]"){
+  emp::Random random(19);
+  SymConfigBase config;
+  config.GRID(1);
+  SymWorld world(random, &config);
+  world.SetPopStruct_Grid(3, 3, false);
+  world.Resize(3, 3);
+
+  WHEN("no neighbor holds a host"){
+    THEN("an invalid position is returned"){
+      REQUIRE(world.GetNeighborHost(4).IsValid() == false);
+    }
+  }
+
+  WHEN("one neighbor holds a host"){
+    world.AddOrgAt(emp::NewPtr<Host>(&random, &world, &config, 0), 1);
+    THEN("its position is returned"){
+      emp::WorldPosition neighbor = world.GetNeighborHost(4);
+      REQUIRE(neighbor.IsValid());
+      REQUIRE(neighbor.GetIndex() == 1);
+    }
+  }
+
+  WHEN("the world is resized past what a WorldPosition can index"){
+    THEN("the resize is refused"){
+      REQUIRE_THROWS(world.Resize(SymWorld::MAX_CELLS + 1));
+      REQUIRE(world.GetSize() == 9);
+    }
+  }
+}
@@ -194,6 +194,18 @@ TEST_CASE("WantsToInfect", "[default]"){
         sym1.Delete();
         sym2.Delete();
     }
+
+    WHEN("sym infection chance is -2"){
+        config.SYM_INFECTION_CHANCE(-2);
+        emp::Ptr<Symbiont> sym = emp::NewPtr<Symbiont>(random, world, &config, int_val);
+
+        THEN("syms start with a random infection chance"){
+            REQUIRE(sym->GetInfectionChance() >= 0);
+            REQUIRE(sym->GetInfectionChance() <= 1);
+        }
+
+        sym.Delete();
+    }
 }
 
 TEST_CASE("InfectionFails", "[default]"){
@@ -357,9 +369,9 @@ TEST_CASE("reproduce", "[default]") {
 
         THEN("Offspring's infection chance equals parent's infection chance") {
             double sym_baby_inf_chance = 0.5;
-            REQUIRE( sym_baby->GetInfectionChance() == sym_baby_inf_chance);
-            REQUIRE( sym_baby->GetInfectionChance() == parent_orig_inf_chance);
-            REQUIRE( sym->GetInfectionChance() == parent_orig_inf_chance);
+            REQUIRE( sym_baby->GetInfectionChance() == StoredTrait(sym_baby_inf_chance));
+            REQUIRE( sym_baby->GetInfectionChance() == StoredTrait(parent_orig_inf_chance));
+            REQUIRE( sym->GetInfectionChance() == StoredTrait(parent_orig_inf_chance));
         }
 
         THEN("Offspring's points are zero") {
@@ -401,10 +413,10 @@ TEST_CASE("reproduce", "[default]") {
         }
 
         THEN("Offspring's infection chance does not equal parent's infection chance") {
-            REQUIRE( sym_baby->GetInfectionChance() != parent_orig_inf_chance);
+            REQUIRE( sym_baby->GetInfectionChance() != StoredTrait(parent_orig_inf_chance));
             REQUIRE( sym_baby->GetInfectionChance() <= 1);
             REQUIRE( sym_baby->GetInfectionChance() >= -1);
-            REQUIRE( sym2->GetInfectionChance() == parent_orig_inf_chance);
+            REQUIRE( sym2->GetInfectionChance() == StoredTrait(parent_orig_inf_chance));
         }
 
         THEN("Offspring's points are zero") {
@@ -548,7 +560,7 @@ TEST_CASE("Symbiont ProcessResources", "[default]"){
 
             THEN("sym receives a donation and stolen resources, host receives betrayal"){
                 REQUIRE(sym->ProcessResources(20) == expected_return);
-                REQUIRE(sym->GetPoints() == expected_sym_points);
+                REQUIRE(sym->GetPoints() == TraitApprox(expected_sym_points, 100));
 
             }
 
@@ -588,7 +600,7 @@ TEST_CASE("Symbiont ProcessResources", "[default]"){
 
                 THEN("Sym steals successfully"){
                     REQUIRE(sym->ProcessResources(0) == expected_return);
-                    REQUIRE(sym->GetPoints() == Approx(expected_sym_points));
+                    REQUIRE(sym->GetPoints() == Approx(expected_sym_points).margin(100 * TRAIT_ROUNDING));
                 }
 
                 host.Delete();
@@ -612,8 +624,8 @@ TEST_CASE("Symbiont ProcessResources", "[default]"){
 
 
         THEN("Sym attempts to give benefit back"){
-            REQUIRE(sym->ProcessResources(50) == expected_return);
-            REQUIRE(sym->GetPoints() == expected_sym_points);
+            REQUIRE(sym->ProcessResources(50) == TraitApprox(expected_return, 500));
+            REQUIRE(sym->GetPoints() == TraitApprox(expected_sym_points, 100));
         }
 
         host.Delete();
@@ -0,0 +1,33 @@
+#include "../../default_mode/TraitValue.h"
+
+TEST_CASE("FixedTrait16 quantization", "[default]"){
+  GIVEN("values in [-1, 1]"){
+    THEN("they are stored within half a step"){
+      for (double val : {-1.0, -0.7, -0.123456, 0.0, 0.05, 0.333333, 0.999, 1.0}) {
+        FixedTrait16 trait = val;
+        REQUIRE(std::abs((double) trait - val) <= 0.5 / FixedTrait16::SCALE);
+      }
+    }
+    THEN("the bounds and zero are exact"){
+      REQUIRE((double) FixedTrait16(-1) == -1);
+      REQUIRE((double) FixedTrait16(0) == 0);
+      REQUIRE((double) FixedTrait16(1) == 1);
+    }
+  }
+
+  GIVEN("values outside [-1, 1]"){
+    THEN("they are clamped"){
+      REQUIRE((double) FixedTrait16(1.5) == 1);
+      REQUIRE((double) FixedTrait16(-3) == -1);
+    }
+  }
+
+  GIVEN("a trait that is mutated"){
+    FixedTrait16 trait = 0.25;
+    trait += 0.1;
+    THEN("the sum is rounded to the nearest step"){
+      REQUIRE((double) trait == (double) FixedTrait16((double) FixedTrait16(0.25) + 0.1));
+      REQUIRE(std::abs((double) trait - 0.35) <= 1 / FixedTrait16::SCALE);
+    }
+  }
+}
@@ -23,7 +23,7 @@ TEST_CASE("EfficientHost Constructor", "[efficient]"){
     double efficiency = 0.5;
     emp::Ptr<EfficientHost> host2 = emp::NewPtr<EfficientHost>(random, world, &config, int_val, syms, repro_syms, points, efficiency);
     CHECK(host2->GetIntVal() == int_val);
-    CHECK(host2->GetEfficiency() == efficiency);
+    CHECK(host2->GetEfficiency() == StoredTrait(efficiency));
     CHECK(host2->GetAge() == 0);
     CHECK(host2->GetPoints() == points);
 
@@ -75,7 +75,7 @@ TEST_CASE("EfficientHost SetEfficiency and GetEfficiency", "[efficient]"){
     double efficiency = 0.5;
     host->SetEfficiency(efficiency);
     double expected_efficieny = 0.5;
-    REQUIRE(host->GetEfficiency() == expected_efficieny);
+    REQUIRE(host->GetEfficiency() == StoredTrait(expected_efficieny));
 
     host.Delete();
 }
@@ -22,7 +22,7 @@ TEST_CASE("EfficientSymbiont Constructor", "[efficient]"){
 
     emp::Ptr<EfficientSymbiont> symbiont2 = emp::NewPtr<EfficientSymbiont>(random, world, &config, int_val, points, efficiency);
     CHECK(symbiont2->GetIntVal() == int_val);
-    CHECK(symbiont2->GetEfficiency() == efficiency);
+    CHECK(symbiont2->GetEfficiency() == StoredTrait(efficiency));
     CHECK(symbiont2->GetAge() == 0);
     CHECK(symbiont2->GetPoints() == points);
 
@@ -57,7 +57,7 @@ TEST_CASE("EfficientSymbiont Mutate", "[efficient]") {
         symbiont->Mutate("vertical");
 
         THEN("Mutation occurs and efficiency value changes, but within bounds") {
-            REQUIRE(symbiont->GetEfficiency() != orig_efficiency);
+            REQUIRE(symbiont->GetEfficiency() != StoredTrait(orig_efficiency));
             REQUIRE(symbiont->GetEfficiency() <= 1);
             REQUIRE(symbiont->GetEfficiency() >= 0);
         }
@@ -79,7 +79,7 @@ TEST_CASE("EfficientSymbiont Mutate", "[efficient]") {
 
 
         THEN("Mutation does not occur and efficiency value does not change") {
-            REQUIRE(symbiont->GetEfficiency() == orig_efficiency);
+            REQUIRE(symbiont->GetEfficiency() == StoredTrait(orig_efficiency));
         }
         symbiont.Delete();
     }
@@ -114,7 +114,7 @@ TEST_CASE("EfficientSymbiont AddPoints", "[efficient]") {
         double actual_points = 5; //points_in * 0.5
 
         THEN("Half points get added") {
-            REQUIRE( symbiont->GetPoints() == actual_points);
+            REQUIRE( symbiont->GetPoints() == TraitApprox(actual_points, points_in));
         }
         symbiont.Delete();
     }
@@ -151,7 +151,7 @@ TEST_CASE("INT_VAL_MUT_RATE", "[efficient]") {
 
         THEN("Efficiency mutates but interaction value does not") {
 
-            REQUIRE(symbiont->GetEfficiency() != orig_efficiency);
+            REQUIRE(symbiont->GetEfficiency() != StoredTrait(orig_efficiency));
             REQUIRE(symbiont->GetEfficiency() <= 1);
             REQUIRE(symbiont->GetEfficiency() >= 0);
             REQUIRE(symbiont->GetIntVal() == int_val);
@@ -170,7 +170,7 @@ TEST_CASE("INT_VAL_MUT_RATE", "[efficient]") {
 
         THEN("Efficiency mutates but interaction value does not") {
 
-            REQUIRE(symbiont->GetEfficiency() != orig_efficiency);
+            REQUIRE(symbiont->GetEfficiency() != StoredTrait(orig_efficiency));
             REQUIRE(symbiont->GetEfficiency() <= 1);
             REQUIRE(symbiont->GetEfficiency() >= 0);
             REQUIRE(symbiont->GetIntVal() == int_val);
@@ -191,7 +191,7 @@ TEST_CASE("INT_VAL_MUT_RATE", "[efficient]") {
 
         THEN("Efficiency does not mutate but interaction value does") {
 
-            REQUIRE(symbiont->GetEfficiency() == orig_efficiency);
+            REQUIRE(symbiont->GetEfficiency() == StoredTrait(orig_efficiency));
             REQUIRE(symbiont->GetIntVal() <= 1);
             REQUIRE(symbiont->GetIntVal() >= -1);
             REQUIRE(symbiont->GetIntVal() != int_val);
@@ -211,7 +211,7 @@ TEST_CASE("INT_VAL_MUT_RATE", "[efficient]") {
 
         THEN("Efficiency does not mutate but interaction value does") {
 
-            REQUIRE(symbiont->GetEfficiency() == orig_efficiency);
+            REQUIRE(symbiont->GetEfficiency() == StoredTrait(orig_efficiency));
             REQUIRE(symbiont->GetIntVal() <= 1);
             REQUIRE(symbiont->GetIntVal() >= -1);
             REQUIRE(symbiont->GetIntVal() != int_val);
@@ -247,9 +247,9 @@ TEST_CASE("EfficientSymbiont Reproduce", "[efficient]") {
 
         THEN("Offspring's efficiency equals parent's efficiency") {
             double sym_baby_efficiency = 0.5;
-            REQUIRE( sym_baby->GetEfficiency() == sym_baby_efficiency);
-            REQUIRE( sym_baby->GetEfficiency() == parent_orig_efficiency);
-            REQUIRE( symbiont->GetEfficiency() == parent_orig_efficiency);
+            REQUIRE( sym_baby->GetEfficiency() == StoredTrait(sym_baby_efficiency));
+            REQUIRE( sym_baby->GetEfficiency() == StoredTrait(parent_orig_efficiency));
+            REQUIRE( symbiont->GetEfficiency() == StoredTrait(parent_orig_efficiency));
         }
 
         THEN("Offspring's points are zero") {
@@ -279,7 +279,7 @@ TEST_CASE("EfficientSymbiont Reproduce", "[efficient]") {
 
 
         THEN("Offspring's efficiency value does not equal parent's efficiency value") {
-            REQUIRE(sym_baby->GetEfficiency() != parent_orig_efficiency);
+            REQUIRE(sym_baby->GetEfficiency() != StoredTrait(parent_orig_efficiency));
             REQUIRE(sym_baby->GetEfficiency() <= 1);
             REQUIRE(sym_baby->GetEfficiency() >= 0);
         }
@@ -319,7 +319,7 @@ TEST_CASE("EfficientSymbiont HorizMutate", "[efficient]") {
         symbiont->Mutate("horizontal");
 
         THEN("Efficiency changes during horizontal mutation, int val stays the same") {
-            REQUIRE(symbiont->GetEfficiency() != efficiency);
+            REQUIRE(symbiont->GetEfficiency() != StoredTrait(efficiency));
             REQUIRE(symbiont->GetIntVal() == int_val);
         }
         symbiont.Delete();
@@ -345,7 +345,7 @@ TEST_CASE("EfficientSymbiont Mutate with horizontal transmission", "[efficient]"
         symbiont->Mutate("horizontal");
 
         THEN("Efficiency changes during horizontal mutation, int val stays the same") {
-            REQUIRE(symbiont->GetEfficiency() != efficiency);
+            REQUIRE(symbiont->GetEfficiency() != StoredTrait(efficiency));
             REQUIRE(symbiont->GetIntVal() == int_val);
         }
         symbiont.Delete();
@@ -371,7 +371,7 @@ TEST_CASE("EfficientSymbiont Mutate with vertical transmission", "[efficient]")
         symbiont->Mutate("vertical");
 
         THEN("Efficiency and int val should change because pulls from regular mutation rate") {
-            REQUIRE(symbiont->GetEfficiency() != efficiency);
+            REQUIRE(symbiont->GetEfficiency() != StoredTrait(efficiency));
             REQUIRE(symbiont->GetIntVal() != int_val);
         }
         symbiont.Delete();
@@ -425,7 +425,7 @@ TEST_CASE("EfficientSymbiont's Process called from Host when mutation rate and s
             }
             REQUIRE(new_infected != nullptr);
             REQUIRE(new_infected->HasSym());
-            REQUIRE(new_infected->GetSymbionts()[0]->GetEfficiency() == efficiency);
+            REQUIRE(new_infected->GetSymbionts()[0]->GetEfficiency() == StoredTrait(efficiency));
         }
     }
 
@@ -463,7 +463,7 @@ TEST_CASE("EfficientSymbiont's Process called from Host when mutation rate and s
             }
             REQUIRE(new_infected != nullptr);
             REQUIRE(new_infected->HasSym());
-            REQUIRE(new_infected->GetSymbionts()[0]->GetEfficiency() != efficiency);
+            REQUIRE(new_infected->GetSymbionts()[0]->GetEfficiency() != StoredTrait(efficiency));
             REQUIRE(new_infected->GetSymbionts()[0]->GetIntVal() != int_val);
         }
 
@@ -503,7 +503,7 @@ TEST_CASE("EfficientSymbiont SetEfficiency and GetEfficiency", "[efficient]"){
     double efficiency = 0.5;
     symbiont->SetEfficiency(efficiency);
     double expected_efficieny = 0.5;
-    REQUIRE(symbiont->GetEfficiency() == expected_efficieny);
+    REQUIRE(symbiont->GetEfficiency() == StoredTrait(expected_efficieny));
 
     symbiont.Delete();
 }
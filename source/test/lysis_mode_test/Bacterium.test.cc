@@ -17,7 +17,7 @@ TEST_CASE("Bacterium constructor, host_incorporation_val", "[lysis]"){
     config.HOST_INC_VAL(0.8);
     emp::Ptr<Bacterium> bacterium2 = emp::NewPtr<Bacterium>(random, world, &config, int_val);
     double expected_inc_val = 0.8;
-    CHECK(bacterium2->GetIncVal()==expected_inc_val);
+    CHECK(bacterium2->GetIncVal()==StoredTrait(expected_inc_val));
     CHECK(bacterium2->GetAge() == 0);
     CHECK(bacterium2->GetPoints() == 0);
 
@@ -36,7 +36,7 @@ TEST_CASE("Bacterium SetIncVal, GetIncVal", "[lysis]"){
     double host_incorporation_val = 0.2;
     bacterium->SetIncVal(host_incorporation_val);
     double expected_inc_val = 0.2;
-    REQUIRE(bacterium->GetIncVal()==expected_inc_val);
+    REQUIRE(bacterium->GetIncVal()==StoredTrait(expected_inc_val));
 
     bacterium.Delete();
 }
@@ -60,7 +60,7 @@ TEST_CASE("Bacterium mutate", "[lysis]"){
         bacterium->Mutate();
 
         THEN("Then mutation occurs and the bacterium's host_inc_val mutates"){
-            REQUIRE(bacterium->GetIncVal() != orig_host_inc_val);
+            REQUIRE(bacterium->GetIncVal() != StoredTrait(orig_host_inc_val));
             REQUIRE(bacterium->GetIncVal() >= 0.0);
             REQUIRE(bacterium->GetIncVal() <= 1.0);
         }
@@ -76,7 +76,7 @@ TEST_CASE("Bacterium mutate", "[lysis]"){
         bacterium->Mutate();
 
         THEN("Then mutations occur but do not occur in the host_inc_val"){
-            REQUIRE(bacterium->GetIncVal() ==  orig_host_inc_val);
+            REQUIRE(bacterium->GetIncVal() ==  StoredTrait(orig_host_inc_val));
         }
 
     bacterium.Delete();
@@ -90,7 +90,7 @@ TEST_CASE("Bacterium mutate", "[lysis]"){
         bacterium->Mutate();
 
         THEN("Mutations do not occur"){
-            REQUIRE(bacterium->GetIncVal() ==  orig_host_inc_val);
+            REQUIRE(bacterium->GetIncVal() ==  StoredTrait(orig_host_inc_val));
         }
 
     bacterium.Delete();
@@ -104,7 +104,7 @@ TEST_CASE("Bacterium mutate", "[lysis]"){
         bacterium->Mutate();
 
         THEN("Mutations do not occur"){
-            REQUIRE(bacterium->GetIncVal() ==  orig_host_inc_val);
+            REQUIRE(bacterium->GetIncVal() ==  StoredTrait(orig_host_inc_val));
         }
 
     bacterium.Delete();
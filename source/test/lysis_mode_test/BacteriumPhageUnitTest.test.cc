@@ -364,7 +364,7 @@ TEST_CASE("Phage overwrites Symbiont ProcessResources", "[lysis]"){
 
     double expected_bacterium_points = 16;
     double expected_phage_points = 0;
-    REQUIRE(bacterium->GetPoints() == expected_bacterium_points);
+    REQUIRE(bacterium->GetPoints() == TraitApprox(expected_bacterium_points, sym_piece));
     REQUIRE(phage->GetPoints() == expected_phage_points);
 
     phage.Delete();
@@ -56,7 +56,7 @@ TEST_CASE("Phage constructor, GetIntVal", "[lysis]") {
         double expected_lysis_chance = 0.5;
 
         THEN("Lysis chance is set to what was passed in"){
-            REQUIRE(phage->GetLysisChance() == expected_lysis_chance);
+            REQUIRE(phage->GetLysisChance() == StoredTrait(expected_lysis_chance));
             REQUIRE(phage->GetAge() == 0);
             REQUIRE(phage->GetPoints() == 0);
             REQUIRE(phage->GetBurstTimer() == 0);
@@ -86,7 +86,7 @@ TEST_CASE("Phage constructor, GetIntVal", "[lysis]") {
         double expected_induction_chance = 0.2;
 
         THEN("Chance of induction is set to what was passed in"){
-            REQUIRE(phage->GetInductionChance() == expected_induction_chance);
+            REQUIRE(phage->GetInductionChance() == StoredTrait(expected_induction_chance));
             REQUIRE(phage->GetAge() == 0);
             REQUIRE(phage->GetPoints() == 0);
             REQUIRE(phage->GetBurstTimer() == 0);
@@ -116,7 +116,7 @@ TEST_CASE("Phage constructor, GetIntVal", "[lysis]") {
         double expected_incorporation_value = 0.3;
 
         THEN("Incorporation val is set to what was passed in"){
-            REQUIRE(phage->GetIncVal() == expected_incorporation_value);
+            REQUIRE(phage->GetIncVal() == StoredTrait(expected_incorporation_value));
             REQUIRE(phage->GetAge() == 0);
             REQUIRE(phage->GetPoints() == 0);
             REQUIRE(phage->GetBurstTimer() == 0);
@@ -149,9 +149,9 @@ TEST_CASE("Phage Reproduce", "[lysis]") {
             REQUIRE( phage->GetIntVal() == parent_orig_int_val);
 
             double phage_baby_lysis_chance = .5;
-            REQUIRE( phage_baby->GetLysisChance() == phage_baby_lysis_chance);
-            REQUIRE( phage_baby->GetLysisChance() == parent_orig_lysis_chance);
-            REQUIRE( phage->GetLysisChance() == parent_orig_lysis_chance);
+            REQUIRE( phage_baby->GetLysisChance() == StoredTrait(phage_baby_lysis_chance));
+            REQUIRE( phage_baby->GetLysisChance() == StoredTrait(parent_orig_lysis_chance));
+            REQUIRE( phage->GetLysisChance() == StoredTrait(parent_orig_lysis_chance));
         }
         THEN("Offspring's points and burst timer are zero") {
             int phage_baby_points = 0;
@@ -176,7 +176,7 @@ TEST_CASE("Phage Reproduce", "[lysis]") {
             REQUIRE( phage_baby->GetIntVal() <= parent_orig_int_val + 0.002*3);
             REQUIRE( phage_baby->GetIntVal() >= parent_orig_int_val - 0.002*3);
 
-            REQUIRE( phage_baby->GetLysisChance() != parent_orig_lysis_chance);
+            REQUIRE( phage_baby->GetLysisChance() != StoredTrait(parent_orig_lysis_chance));
             REQUIRE( phage_baby->GetLysisChance() <= parent_orig_lysis_chance + 0.002*3);
             REQUIRE( phage_baby->GetLysisChance() >= parent_orig_lysis_chance - 0.002*3);
         }
@@ -233,7 +233,7 @@ TEST_CASE("Phage SetLysisChance, GetLysisChance", "[lysis]"){
     double lysis_chance = 0.5;
     phage->SetLysisChance(lysis_chance);
     double expected_lysis_chance = 0.5;
-    REQUIRE(phage->GetLysisChance() == expected_lysis_chance);
+    REQUIRE(phage->GetLysisChance() == StoredTrait(expected_lysis_chance));
 
     phage.Delete();
 }
@@ -249,7 +249,7 @@ TEST_CASE("Phage SetInductionChance, GetInductionChance", "[lysis]"){
     double induction_chance = 0.5;
     phage->SetInductionChance(induction_chance);
     double expected_induction_chance = 0.5;
-    REQUIRE(phage->GetInductionChance() == expected_induction_chance);
+    REQUIRE(phage->GetInductionChance() == StoredTrait(expected_induction_chance));
 
     phage.Delete();
 }
@@ -265,7 +265,7 @@ TEST_CASE("Phage SetIncVal, GetIncVal", "[lysis]"){
     double incorporation_val = 0.5;
     phage->SetIncVal(incorporation_val);
     double expected_incorporation_value = 0.5;
-    REQUIRE(phage->GetIncVal() == expected_incorporation_value);
+    REQUIRE(phage->GetIncVal() == StoredTrait(expected_incorporation_value));
 
     phage.Delete();
 }
@@ -316,13 +316,13 @@ TEST_CASE("Phage Mutate", "[lysis]"){
         emp::Ptr<Organism> phage = emp::NewPtr<Phage>(random, world, &config, int_val);
         phage->Mutate();
         THEN("Mutation occurs and chance of lysis changes") {
-            REQUIRE(phage->GetLysisChance() != 0.5);
+            REQUIRE(phage->GetLysisChance() != StoredTrait(0.5));
             REQUIRE(phage->GetLysisChance() >= 0.5 - 0.002*3);
             REQUIRE(phage->GetLysisChance() <= 0.5 + 0.002*3);
-            REQUIRE(phage->GetInductionChance() != 0.5);
+            REQUIRE(phage->GetInductionChance() != StoredTrait(0.5));
             REQUIRE(phage->GetInductionChance() >= 0.5 - 0.002*3);
             REQUIRE(phage->GetInductionChance() <= 0.5 + 0.002*3);
-            REQUIRE(phage->GetIncVal() != 0.5);
+            REQUIRE(phage->GetIncVal() != StoredTrait(0.5));
             REQUIRE(phage->GetIncVal() >= 0.5 - 0.002*3);
             REQUIRE(phage->GetIncVal() <= 0.5 + 0.002*3);
         }
@@ -341,9 +341,9 @@ TEST_CASE("Phage Mutate", "[lysis]"){
         double induction_chance_post_mutation = 0.5;
         double incorporation_val_post_mutation = 0.5;
         THEN("Mutation does not occur and chance of lysis/chance of induction does not change") {
-            REQUIRE(phage->GetLysisChance() == Approx(lysis_chance_post_mutation));
-            REQUIRE(phage->GetInductionChance() == Approx(induction_chance_post_mutation));
-            REQUIRE(phage->GetIncVal() == Approx(incorporation_val_post_mutation));
+            REQUIRE(phage->GetLysisChance() == Approx(StoredTrait(lysis_chance_post_mutation)));
+            REQUIRE(phage->GetInductionChance() == Approx(StoredTrait(induction_chance_post_mutation)));
+            REQUIRE(phage->GetIncVal() == Approx(StoredTrait(incorporation_val_post_mutation)));
         }
         phage.Delete();
     }
@@ -361,9 +361,9 @@ TEST_CASE("Phage Mutate", "[lysis]"){
         double induction_chance_post_mutation = 0.5;
         double incorporation_val_post_mutation = 0.5;
         THEN("Mutation does not occur and chance of lysis/chance of induction does not change") {
-            REQUIRE(phage->GetLysisChance() == Approx(lysis_chance_post_mutation));
-            REQUIRE(phage->GetInductionChance() == Approx(induction_chance_post_mutation));
-            REQUIRE(phage->GetIncVal() == Approx(incorporation_val_post_mutation));
+            REQUIRE(phage->GetLysisChance() == Approx(StoredTrait(lysis_chance_post_mutation)));
+            REQUIRE(phage->GetInductionChance() == Approx(StoredTrait(induction_chance_post_mutation)));
+            REQUIRE(phage->GetIncVal() == Approx(StoredTrait(incorporation_val_post_mutation)));
         }
         phage.Delete();
     }
@@ -381,9 +381,9 @@ TEST_CASE("Phage Mutate", "[lysis]"){
         double induction_chance_post_mutation = 0.5;
         double incorporation_val_post_mutation = 0.5;
         THEN("Mutation does not occur and chance of lysis/chance of induction does not change") {
-            REQUIRE(phage->GetLysisChance() == Approx(lysis_chance_post_mutation));
-            REQUIRE(phage->GetInductionChance() == Approx(induction_chance_post_mutation));
-            REQUIRE(phage->GetIncVal() == Approx(incorporation_val_post_mutation));
+            REQUIRE(phage->GetLysisChance() == Approx(StoredTrait(lysis_chance_post_mutation)));
+            REQUIRE(phage->GetInductionChance() == Approx(StoredTrait(induction_chance_post_mutation)));
+            REQUIRE(phage->GetIncVal() == Approx(StoredTrait(incorporation_val_post_mutation)));
         }
         phage.Delete();
     }
@@ -638,7 +638,7 @@ TEST_CASE("Phage ProcessResources", "[lysis]"){
                 double expected_resources = 10;
 
                 THEN("The host resources stay the same"){
-                    REQUIRE(phage->ProcessResources(sym_piece)==expected_resources);
+                    REQUIRE(phage->ProcessResources(sym_piece)==TraitApprox(expected_resources, 10 * orig_host_resources));
                 }
             }
 
@@ -689,3 +689,16 @@ TEST_CASE("Phage MakeNew", "[lysis]"){
     phage.Delete();
     new_phage.Delete();
 }
+
+TEST_CASE("Phage HasDefaultResourceProcessing", "[lysis]"){
+    emp::Ptr<emp::Random> random = new emp::Random(9);
+    SymConfigBase config;
+    LysisWorld world(*random, &config);
+    emp::Ptr<Organism> phage = emp::NewPtr<Phage>(random, &world, &config, 0);
+
+    THEN("Phage go through their own ProcessResources"){
+        REQUIRE(!phage->HasDefaultResourceProcessing());
+    }
+
+    phage.Delete();
+}
@@ -12,7 +12,7 @@ TEST_CASE("PGGHost constructor", "[pgg]"){
 
     int_val = -1;
     emp::Ptr<PGGHost> host1 = emp::NewPtr<PGGHost>(random, world, &config, int_val);
-    CHECK(host1->GetIntVal() == int_val);
+    CHECK(host1->GetIntVal() == StoredTrait(int_val));
     CHECK(host1->GetAge() == 0);
     CHECK(host1->GetPoints() == 0);
 
@@ -21,13 +21,13 @@ TEST_CASE("PGGHost constructor", "[pgg]"){
     emp::vector<emp::Ptr<Organism>> repro_syms = {};
     double points = 10;
     emp::Ptr<PGGHost> host2 = emp::NewPtr<PGGHost>(random, world, &config, int_val, syms, repro_syms, points);
-    CHECK(host2->GetIntVal() == int_val);
+    CHECK(host2->GetIntVal() == StoredTrait(int_val));
     CHECK(host2->GetAge() == 0);
     CHECK(host2->GetPoints() == points);
 
     int_val = 1;
     emp::Ptr<PGGHost> host3 = emp::NewPtr<PGGHost>(random, world, &config, int_val);
-    CHECK(host3->GetIntVal() == int_val);
+    CHECK(host3->GetIntVal() == StoredTrait(int_val));
     CHECK(host3->GetAge() == 0);
     CHECK(host3->GetPoints() == 0);
 
@@ -76,7 +76,7 @@ TEST_CASE("PGGHost DistributeResources", "[pgg]") {
         THEN("Points increase") {
             double expected_points = resources - (resources * int_val); // 48
             double points = host->GetPoints();
-            REQUIRE(points == expected_points);
+            REQUIRE(points == TraitApprox(expected_points, resources));
             REQUIRE(points > orig_points);
         }
         host.Delete();
@@ -117,7 +117,7 @@ TEST_CASE("PGGHost DistributeResources", "[pgg]") {
             double add_points  = resources - host_defense;
             double expected_points = orig_points + add_points;
             double points = host->GetPoints();
-            REQUIRE(points == expected_points);
+            REQUIRE(points == TraitApprox(expected_points, resources));
             REQUIRE(points > orig_points);
         }
         host.Delete();
@@ -59,9 +59,9 @@ TEST_CASE("PGGHost DistribResources", "[pgg]") {
         THEN("Host and Symbionts points increase") {
 
             for( emp::Ptr<Organism> symbiont : syms) {
-                REQUIRE(symbiont->GetPoints() == sym_points);
+                REQUIRE(symbiont->GetPoints() == TraitApprox(sym_points, 10 * resources));
             }
-            REQUIRE(host->GetPoints() == host_points);
+            REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
         }
         host.Delete();
     }
@@ -96,7 +96,7 @@ TEST_CASE("PGGHost DistribResources", "[pgg]") {
                 for( emp::Ptr<Organism> symbiont : syms) {
                     REQUIRE(symbiont->GetPoints() == sym_orig_points);
                 }
-                REQUIRE(host->GetPoints() == host_points);
+                REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
                 REQUIRE(host->GetPoints() > host_orig_points);
             }
             host.Delete();
@@ -130,10 +130,10 @@ TEST_CASE("PGGHost DistribResources", "[pgg]") {
 
             THEN("Symbionts points and Host points increase") {
                 for( emp::Ptr<Organism> symbiont : syms) {
-                    REQUIRE(symbiont->GetPoints() == sym_points);
+                    REQUIRE(symbiont->GetPoints() == TraitApprox(sym_points, 10 * resources));
                     REQUIRE(symbiont->GetPoints() > sym_orig_points);
                 }
-                REQUIRE(host->GetPoints() == host_points);
+                REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
                 REQUIRE(host->GetPoints() > host_orig_points);
             }
             host.Delete();
@@ -159,8 +159,8 @@ TEST_CASE("PGGHost DistribResources", "[pgg]") {
         host_portion = host_portion - sym_steals; //remove stolen resources from host's portion
 
         THEN("Symbionts points and Host points increase the correct amounts") {
-            REQUIRE(symbiont->GetPoints() == sym_orig_points+sym_portion);
-            REQUIRE(host->GetPoints() == host_orig_points+host_portion);
+            REQUIRE(symbiont->GetPoints() == TraitApprox(sym_orig_points+sym_portion, 10 * resources));
+            REQUIRE(host->GetPoints() == TraitApprox(host_orig_points+host_portion, 10 * resources));
         }
         host.Delete();
     }
@@ -199,11 +199,11 @@ TEST_CASE("PGGHost DistribResources", "[pgg]") {
            for( emp::Ptr<Organism> symbiont : syms) {
 
 
-               REQUIRE(symbiont->GetPoints() == sym_portion);
+               REQUIRE(symbiont->GetPoints() == TraitApprox(sym_portion, 10 * resources));
                REQUIRE(symbiont->GetPoints() > sym_orig_points);
             }
 
-            REQUIRE(host->GetPoints() == host_final_portion);
+            REQUIRE(host->GetPoints() == TraitApprox(host_final_portion, 10 * resources));
             REQUIRE(host->GetPoints() > host_orig_points);
         }
         host.Delete();
@@ -242,7 +242,7 @@ TEST_CASE("PGGHost DistribResources", "[pgg]") {
                 REQUIRE(symbiont->GetPoints() == sym_points);
                 REQUIRE(symbiont->GetPoints() == symbiont_orig_points);
             }
-            REQUIRE(host->GetPoints() == host_points);
+            REQUIRE(host->GetPoints() == TraitApprox(host_points, 10 * resources));
             REQUIRE(host->GetPoints() > host_orig_points);
 
         }
@@ -328,8 +328,8 @@ TEST_CASE("PGGSymbiont  PGGHost Pool Interaction", "[pgg]"){
     double s2_final_source = 48+9*1.1;
 
 
-    REQUIRE(symbiont1->GetPoints() == s1_final_source);
-    REQUIRE(symbiont2->GetPoints() == s2_final_source);
+    REQUIRE(symbiont1->GetPoints() == TraitApprox(s1_final_source, 10 * resources));
+    REQUIRE(symbiont2->GetPoints() == TraitApprox(s2_final_source, 10 * resources));
     REQUIRE(host->GetPoints() == host_portion);
     REQUIRE(host->GetPool() == host_pool);
     host.Delete();
@@ -19,7 +19,7 @@ TEST_CASE("PGGSymbiont Constructor", "[pgg]") {
 
     donation = 2;
     emp::Ptr<PGGSymbiont> symbiont2 = emp::NewPtr<PGGSymbiont>(random, world, &config, int_val,donation);
-    CHECK(symbiont2->GetDonation() == 2);
+    CHECK(symbiont2->GetDonation() == StoredTrait(2));
     CHECK(symbiont2->GetAge() == 0);
     CHECK(symbiont2->GetPoints() == 0);
 
@@ -46,7 +46,7 @@ TEST_CASE("PGGmutate", "[pgg]") {
         symbiont->Mutate();
 
         THEN("Mutation occurs and donation value changes, but stays within bounds") {
-            REQUIRE(symbiont->GetDonation() != donation);
+            REQUIRE(symbiont->GetDonation() != StoredTrait(donation));
             REQUIRE(symbiont->GetDonation() <= 1);
             REQUIRE(symbiont->GetDonation() >= 0);
         }
@@ -65,7 +65,7 @@ TEST_CASE("PGGmutate", "[pgg]") {
 
 
         THEN("Mutation does not occur and donation value does not change") {
-            REQUIRE(symbiont->GetDonation() == donation);
+            REQUIRE(symbiont->GetDonation() == StoredTrait(donation));
         }
         symbiont.Delete();
     }
@@ -87,7 +87,7 @@ TEST_CASE("PGGSymbiont ProcessPool", "[pgg]"){
 
     host->DistribResources(40);
 
-    CHECK(symbiont->GetPoints() == 40.4);
+    CHECK(symbiont->GetPoints() == TraitApprox(40.4, 400));
     CHECK(host->GetPoints() == 0);
 
     host.Delete();
@@ -212,7 +212,7 @@ TEST_CASE("PGGSymbiont ProcessResources", "[pgg]"){
 
             THEN("sym receives a donation and stolen resources, host receives betrayal"){
                 REQUIRE(symbiont->ProcessResources(20) == expected_return);
-                REQUIRE(symbiont->GetPoints() == expected_sym_points);
+                REQUIRE(symbiont->GetPoints() == TraitApprox(expected_sym_points, 100));
 
             }
             host.Delete();
@@ -250,7 +250,7 @@ TEST_CASE("PGGSymbiont ProcessResources", "[pgg]"){
 
                 THEN("Sym steals successfully"){
                     REQUIRE(symbiont->ProcessResources(0) == expected_return);
-                    REQUIRE(symbiont->GetPoints() == Approx(expected_sym_points));
+                    REQUIRE(symbiont->GetPoints() == Approx(expected_sym_points).margin(100 * TRAIT_ROUNDING));
                 }
                 host.Delete();
             }
@@ -273,8 +273,8 @@ TEST_CASE("PGGSymbiont ProcessResources", "[pgg]"){
 
 
         THEN("Sym attempts to give benefit back"){
-            REQUIRE(symbiont->ProcessResources(50) == expected_return);
-            REQUIRE(symbiont->GetPoints() == expected_sym_points);
+            REQUIRE(symbiont->ProcessResources(50) == TraitApprox(expected_return, 500));
+            REQUIRE(symbiont->GetPoints() == TraitApprox(expected_sym_points, 100));
         }
         host.Delete();
     }
@@ -0,0 +1,279 @@
+#a script to check that a candidate build of symbulation behaves like a reference build
+#optimizations that change the order random numbers are drawn in make exact output
+#matching impossible, so instead canonical configurations are run over many seeds
+#with both builds and the distributions of their outcomes are compared
+#EX: python3 stats_scripts/equivalence_test.py ../reference_checkout . --seeds 1 31
+import argparse
+import json
+import math
+import os
+import shutil
+import subprocess
+import sys
+from concurrent.futures import ThreadPoolExecutor
+
+#the settings every run uses on top of the config file, so that rows line up
+#only settings every version of symbulation knows are used, so that older builds can be the reference
+common_settings = {"DATA_INT": 50, "UPDATES": 2000, "GRID_X": 50, "GRID_Y": 50, "PHYLOGENY": 0}
+
+#the settings file used by builds that do not have one next to their executables
+default_config_file = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "SymSettings.cfg")
+
+#canonical configurations: name -> (mode executable, settings)
+configurations = {
+    "default": ("default", {}),
+    "default_free_living": ("default", {"FREE_LIVING_SYMS": 1, "FREE_SYM_RES_DISTRIBUTE": 50,
+                                        "MOVE_FREE_SYMS": 1}),
+    "default_limited_res": ("default", {"LIMITED_RES_TOTAL": 100000, "LIMITED_RES_INFLOW": 100000}),
+    "efficient": ("efficient", {"FREE_LIVING_SYMS": 1, "FREE_SYM_RES_DISTRIBUTE": 50}),
+    "lysis": ("lysis", {"LYSIS": 1, "SYM_LIMIT": 5}),
+    "pgg": ("pgg", {"PGG": 1, "PGG_DONATE": 0.1}),
+}
+
+#the columns compared: (file, column)
+metrics = [("HostVals", "count"), ("HostVals", "mean_intval"),
+           ("SymVals", "count"), ("SymVals", "mean_intval")]
+
+
+def run_one(executable, run_dir, config_name, settings, seed):
+    '''Runs a single replicate in run_dir, which holds the config file.
+    Its data files are named _<config_name>_SEED<seed> and its output is kept in a log.'''
+    command = [executable, "-SEED", str(seed), "-FILE_NAME", "_" + config_name]
+    for key, val in settings.items():
+        command += ["-" + key, str(val)]
+    log_name = os.path.join(run_dir, "Output_" + config_name + "_SEED" + str(seed) + ".data")
+    with open(log_name, "w") as log:
+        status = subprocess.call(command, cwd=run_dir, stdout=log, stderr=subprocess.STDOUT)
+    if status != 0:
+        sys.exit("Run failed (see " + log_name + "): " + " ".join(command))
+
+
+def read_column(file_name, column):
+    '''Returns a dict of update -> value of one column of a data file.
+    Values that are not finite (such as the mean of an extinct population) are dropped.'''
+    values = {}
+    with open(file_name) as data:
+        header = data.readline().strip().split(",")
+        update_index = header.index("update")
+        index = header.index(column)
+        for line in data:
+            split_line = line.strip().split(",")
+            if len(split_line) <= index:
+                continue
+            val = float(split_line[index])
+            if math.isfinite(val):
+                values[int(split_line[update_index])] = val
+    return values
+
+
+def mean(xs):
+    return sum(xs) / len(xs)
+
+
+def sd(xs):
+    if len(xs) < 2:
+        return 0.0
+    m = mean(xs)
+    return math.sqrt(sum((x - m) ** 2 for x in xs) / (len(xs) - 1))
+
+
+def cohens_d(xs, ys):
+    '''Difference of means in units of the pooled standard deviation (0 if neither sample varies).'''
+    pooled_var = ((len(xs) - 1) * sd(xs) ** 2 + (len(ys) - 1) * sd(ys) ** 2) / max(len(xs) + len(ys) - 2, 1)
+    diff = mean(ys) - mean(xs)
+    if pooled_var == 0:
+        return 0.0 if diff == 0 else math.copysign(math.inf, diff)
+    return diff / math.sqrt(pooled_var)
+
+
+def ks_test(xs, ys):
+    '''Two-sample Kolmogorov-Smirnov test.
+    Returns the statistic D (the largest gap between the two empirical distributions,
+    which doubles as the effect size) and its asymptotic p-value.'''
+    xs = sorted(xs)
+    ys = sorted(ys)
+    n, m = len(xs), len(ys)
+    i = j = 0
+    d = 0.0
+    while i < n and j < m:
+        val = min(xs[i], ys[j])
+        while i < n and xs[i] == val:
+            i += 1
+        while j < m and ys[j] == val:
+            j += 1
+        d = max(d, abs(i / n - j / m))
+    effective_n = n * m / (n + m)
+    lam = (math.sqrt(effective_n) + 0.12 + 0.11 / math.sqrt(effective_n)) * d
+    if lam < 0.2:
+        return d, 1.0
+    p = 0.0
+    for k in range(1, 101):
+        p += 2 * (-1) ** (k - 1) * math.exp(-2 * k * k * lam * lam)
+    return d, min(max(p, 0.0), 1.0)
+
+
+def mann_whitney_test(xs, ys):
+    '''Two-sided Mann-Whitney U test with the tie-corrected normal approximation.
+    Returns its p-value.'''
+    n, m = len(xs), len(ys)
+    pooled = sorted([(x, 0) for x in xs] + [(y, 1) for y in ys])
+    rank_sum = 0.0
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j < len(pooled) and pooled[j][0] == pooled[i][0]:
+            j += 1
+        rank = (i + j + 1) / 2
+        rank_sum += rank * sum(1 for k in range(i, j) if pooled[k][1] == 0)
+        tie_term += (j - i) ** 3 - (j - i)
+        i = j
+    u = rank_sum - n * (n + 1) / 2
+    total = n + m
+    var = n * m / 12 * ((total + 1) - tie_term / (total * (total - 1)))
+    if var <= 0:
+        return 1.0
+    z = (abs(u - n * m / 2) - 0.5) / math.sqrt(var)
+    return min(math.erfc(max(z, 0) / math.sqrt(2)), 1.0)
+
+
+def compare(reference, candidate):
+    '''Runs both tests on two samples and summarizes them.'''
+    d_stat, ks_p = ks_test(reference, candidate)
+    return {"n_reference": len(reference), "n_candidate": len(candidate),
+            "mean_reference": mean(reference), "sd_reference": sd(reference),
+            "mean_candidate": mean(candidate), "sd_candidate": sd(candidate),
+            "cohens_d": cohens_d(reference, candidate), "ks_d": d_stat,
+            "ks_p": ks_p, "mann_whitney_p": mann_whitney_test(reference, candidate)}
+
+
+def summarize_runs(run_dir, config_name, seeds, file_name, column):
+    '''Returns the per-seed trajectories (dicts of update -> value) of one column.'''
+    return [read_column(os.path.join(run_dir, file_name + "_" + config_name + "_SEED" + str(seed) + ".data"), column)
+            for seed in seeds]
+
+
+def compare_metric(ref_trajectories, cand_trajectories):
+    '''Compares the final values, the time averages and each recorded update of two
+    sets of trajectories. Returns the list of comparisons made.'''
+    results = []
+    updates = set.intersection(*[set(t) for t in ref_trajectories + cand_trajectories]) \
+        if ref_trajectories and cand_trajectories else set()
+    last = max([max(t) for t in ref_trajectories + cand_trajectories if t], default=None)
+    #final values, only from runs that recorded the last update (intval is dropped after extinction)
+    finals = [[t[last] for t in trajectories if last in t] for trajectories in (ref_trajectories, cand_trajectories)]
+    if finals[0] and finals[1]:
+        results.append(dict(compare(*finals), kind="final"))
+    averages = [[mean(list(t.values())) for t in trajectories if t]
+                for trajectories in (ref_trajectories, cand_trajectories)]
+    if averages[0] and averages[1]:
+        results.append(dict(compare(*averages), kind="time_mean"))
+    #the update where the distributions differ the most
+    worst = None
+    for update in sorted(updates):
+        if update == last:
+            continue
+        result = compare([t[update] for t in ref_trajectories], [t[update] for t in cand_trajectories])
+        result["kind"] = "trajectory"
+        result["update"] = update
+        result["num_updates"] = len(updates)
+        if worst is None or min(result["ks_p"], result["mann_whitney_p"]) < \
+                min(worst["ks_p"], worst["mann_whitney_p"]):
+            worst = result
+    if worst is not None:
+        results.append(worst)
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Statistically compare a candidate build of symbulation to a reference build.")
+    parser.add_argument("reference", help="directory holding the reference symbulation_<mode> executables")
+    parser.add_argument("candidate", help="directory holding the candidate symbulation_<mode> executables")
+    parser.add_argument("--seeds", nargs=2, type=int, default=[1, 31], metavar=("START", "END"),
+                        help="run seeds START up to END (default 1 31)")
+    parser.add_argument("--candidate-seed-offset", type=int, default=0,
+                        help="add this to each seed for the candidate, to check the harness by comparing a build to itself")
+    parser.add_argument("--configs", default=",".join(configurations),
+                        help="comma separated configurations to run (default all): " + ",".join(configurations))
+    parser.add_argument("--config-file",
+                        help="settings file both builds start from (default: the SymSettings.cfg next to each "
+                             "build's executables, or this checkout's if there is none)")
+    parser.add_argument("--set", nargs=2, action="append", default=[], metavar=("KEY", "VALUE"),
+                        help="override a setting in every run, e.g. --set UPDATES 5000")
+    parser.add_argument("--alpha", type=float, default=0.01,
+                        help="family-wise false failure rate, Bonferroni corrected over all tests (default 0.01)")
+    parser.add_argument("--work-dir", default="equivalence_runs", help="where to run (default equivalence_runs)")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="runs to execute at once")
+    parser.add_argument("--json", help="also write the results to this file")
+    args = parser.parse_args()
+
+    seeds = list(range(args.seeds[0], args.seeds[1]))
+    config_names = args.configs.split(",")
+    for name in config_names:
+        if name not in configurations:
+            sys.exit("Unknown configuration " + name)
+    overrides = {key: val for key, val in args.set}
+
+    builds = {"reference": (args.reference, seeds),
+              "candidate": (args.candidate, [s + args.candidate_seed_offset for s in seeds])}
+    jobs = []
+    for build, (exe_dir, build_seeds) in builds.items():
+        run_dir = os.path.join(args.work_dir, build)
+        os.makedirs(run_dir, exist_ok=True)
+        #each build reads its own settings file, since older builds reject settings they do not know
+        config_file = args.config_file
+        if config_file is None:
+            config_file = os.path.join(exe_dir, "SymSettings.cfg")
+            if not os.path.exists(config_file):
+                config_file = default_config_file
+        shutil.copy(config_file, os.path.join(run_dir, "SymSettings.cfg"))
+        for name in config_names:
+            mode, settings = configurations[name]
+            executable = os.path.abspath(os.path.join(exe_dir, "symbulation_" + mode))
+            if not os.path.exists(executable):
+                sys.exit("Missing " + executable + ", build it with make " + mode + "-mode")
+            full_settings = dict(common_settings, **settings, **overrides)
+            for seed in build_seeds:
+                jobs.append((executable, run_dir, name, full_settings, seed))
+
+    print("Running", len(jobs), "runs of", len(config_names), "configurations over", len(seeds), "seeds")
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        for future in [pool.submit(run_one, *job) for job in jobs]:
+            future.result()
+
+    results = []
+    for name in config_names:
+        for file_name, column in metrics:
+            trajectories = [summarize_runs(os.path.join(args.work_dir, build), name, build_seeds, file_name, column)
+                            for build, (exe_dir, build_seeds) in builds.items()]
+            for result in compare_metric(*trajectories):
+                result.update(config=name, metric=file_name + ":" + column)
+                results.append(result)
+
+    #each trajectory test is the worst of many updates, so it is corrected for all of them
+    num_tests = sum(r.get("num_updates", 1) * 2 for r in results)
+    threshold = args.alpha / max(num_tests, 1)
+    num_failed = 0
+    row = "{:<20} {:<20} {:<16} {:>11} {:>11} {:>7} {:>5} {:>9} {:>9}  {}"
+    print(row.format("config", "metric", "kind", "reference", "candidate", "d", "D", "ks_p", "mw_p", "result"))
+    for r in results:
+        r["passed"] = min(r["ks_p"], r["mann_whitney_p"]) >= threshold
+        num_failed += not r["passed"]
+        kind = r["kind"] + ("@" + str(r["update"]) if "update" in r else "")
+        print(row.format(r["config"], r["metric"], kind, "{:.4g}".format(r["mean_reference"]),
+                         "{:.4g}".format(r["mean_candidate"]), "{:.2f}".format(r["cohens_d"]),
+                         "{:.2f}".format(r["ks_d"]), "{:.2e}".format(r["ks_p"]),
+                         "{:.2e}".format(r["mann_whitney_p"]), "PASS" if r["passed"] else "FAIL"))
+    print("Significance threshold per test:", "{:.2e}".format(threshold), "(alpha", args.alpha, "over", num_tests, "tests)")
+    print("FAILED" if num_failed else "PASSED", num_failed, "of", len(results), "comparisons differ")
+
+    if args.json:
+        with open(args.json, "w") as out:
+            json.dump({"alpha": args.alpha, "threshold": threshold, "seeds": seeds,
+                       "candidate_seed_offset": args.candidate_seed_offset,
+                       "passed": num_failed == 0, "results": results}, out, indent=2)
+    return 1 if num_failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,188 @@
+#a script to measure how fast each mode of symbulation runs, for tracking performance between releases
+#run it with make bench, which builds every mode first, or directly from the repository root
+#EX: python3 stats_scripts/throughput_bench.py --grids 100,500 --output bench_results.json
+import argparse
+import json
+import os
+import platform
+import shutil
+import subprocess
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+modes = ["default", "efficient", "lysis", "pgg"]
+
+#settings every scenario uses on top of the config file
+common_settings = {"SEED": 1, "GRID": 1, "DATA_MANIFEST": "HostVals:count,SymVals:count",
+                   "DELTA_ENCODE_DATA": 0, "SINGLE_DATA_STREAM": 0, "ADAPTIVE_DATA": 0,
+                   "NO_MUT_UPDATES": 0, "FREE_LIVING_SYMS": 0, "PHYLOGENY": 0, "LIMITED_RES_TOTAL": -1}
+
+#settings each mode needs to do its mode specific work
+mode_settings = {"default": {}, "efficient": {}, "lysis": {"LYSIS": 1}, "pgg": {"PGG": 1, "PGG_DONATE": 0.1}}
+
+
+def variant_settings(variant, cells):
+    '''Returns the settings that turn on one optional feature, scaled to the world size.'''
+    if variant == "free_living_syms":
+        return {"FREE_LIVING_SYMS": 1, "FREE_SYM_RES_DISTRIBUTE": 50, "MOVE_FREE_SYMS": 1}
+    if variant == "phylogeny":
+        return {"PHYLOGENY": 1}
+    if variant == "limited_res":
+        #enough inflow for about half the hosts to be fed each update
+        return {"LIMITED_RES_TOTAL": cells * 100, "LIMITED_RES_INFLOW": cells * 50}
+    return {}
+
+
+def num_updates(cells, work):
+    '''Returns how many updates to time, so that every grid size does a similar amount of work.'''
+    return max(3, work // cells)
+
+
+def run(executable, run_dir, name, settings):
+    '''Runs symbulation once and returns its wall clock seconds and peak resident memory in KB.'''
+    command = [executable, "-FILE_NAME", "_" + name]
+    for key, val in settings.items():
+        command += ["-" + key, str(val)]
+    with open(os.path.join(run_dir, "Output_" + name + ".data"), "w") as log:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, cwd=run_dir, stdout=log, stderr=subprocess.STDOUT)
+        _, status, usage = os.wait4(process.pid, 0)
+        seconds = time.perf_counter() - start
+    process.returncode = status #already reaped by wait4
+    if status != 0:
+        sys.exit("Run failed (see " + log.name + "): " + " ".join(command))
+    return seconds, usage.ru_maxrss
+
+
+def orgs_per_update(run_dir, name):
+    '''Returns the average number of hosts plus symbionts alive per update, from the run's data files.'''
+    totals = []
+    for file_name in ["HostVals", "SymVals"]:
+        with open(os.path.join(run_dir, file_name + "_" + name + "_SEED1.data")) as data:
+            header = data.readline().strip().split(",")
+            index = header.index("count")
+            counts = [float(line.strip().split(",")[index]) for line in data if line.strip()]
+        totals.append(sum(counts) / len(counts) if counts else 0)
+    return sum(totals)
+
+
+def time_scenario(executable, run_dir, name, settings, updates, repeats):
+    '''Times a scenario by the difference between a run of 1 update and a run of 1 + updates,
+    so that creating and destroying the world is not counted. Returns the median of the repeats.'''
+    results = []
+    for _ in range(repeats):
+        setup_seconds, _ = run(executable, run_dir, name, dict(settings, UPDATES=1, DATA_INT=1))
+        seconds, peak_rss = run(executable, run_dir, name,
+                                dict(settings, UPDATES=1 + updates, DATA_INT=max(1, updates // 10)))
+        results.append((max(seconds - setup_seconds, 1e-9), setup_seconds, peak_rss))
+    results.sort()
+    seconds, setup_seconds, peak_rss = results[len(results) // 2]
+    orgs = orgs_per_update(run_dir, name) * updates
+    return {"updates": updates, "seconds": seconds, "setup_seconds": setup_seconds,
+            "updates_per_second": updates / seconds, "orgs_per_second": orgs / seconds,
+            "peak_rss_kb": peak_rss}
+
+
+def git_commit():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "HEAD"], stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return ""
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure the throughput of every symbulation mode.")
+    parser.add_argument("--exe-dir", default=".", help="directory holding the symbulation_<mode> executables")
+    parser.add_argument("--modes", default=",".join(modes), help="comma separated modes (default all)")
+    parser.add_argument("--grids", default="100,500,1000,2000",
+                        help="comma separated grid widths, each run on a square grid (default 100,500,1000,2000)")
+    parser.add_argument("--work", type=int, default=5000000,
+                        help="host updates to time per scenario, divided by the grid size to get the updates (default 5000000)")
+    parser.add_argument("--repeats", type=int, default=1, help="times to run each scenario, the median is reported")
+    parser.add_argument("--scaling-grid", type=int, default=500,
+                        help="grid width used to measure scaling over concurrent runs (default 500, 0 to skip)")
+    parser.add_argument("--max-jobs", type=int, default=os.cpu_count(), help="most concurrent runs for scaling")
+    parser.add_argument("--config-file", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "SymSettings.cfg"),
+                        help="settings file the scenarios start from")
+    parser.add_argument("--work-dir", default="bench_runs", help="where to run (default bench_runs)")
+    parser.add_argument("--output", default="bench_results.json", help="JSON file to write (default bench_results.json)")
+    args = parser.parse_args()
+
+    bench_modes = args.modes.split(",")
+    grids = [int(g) for g in args.grids.split(",")]
+    executables = {}
+    for mode in bench_modes:
+        if mode not in modes:
+            sys.exit("Unknown mode " + mode)
+        executables[mode] = os.path.abspath(os.path.join(args.exe_dir, "symbulation_" + mode))
+        if not os.path.exists(executables[mode]):
+            sys.exit("Missing " + executables[mode] + ", build it with make " + mode + "-mode")
+    os.makedirs(args.work_dir, exist_ok=True)
+    shutil.copy(args.config_file, os.path.join(args.work_dir, "SymSettings.cfg"))
+
+    scenarios = []
+    for mode in bench_modes:
+        for grid in grids:
+            cells = grid * grid
+            for variant in ["base", "free_living_syms", "phylogeny", "limited_res"]:
+                name = mode + "_" + str(grid) + "_" + variant
+                settings = dict(common_settings, GRID_X=grid, GRID_Y=grid, **mode_settings[mode],
+                                **variant_settings(variant, cells))
+                result = time_scenario(executables[mode], args.work_dir, name, settings,
+                                       num_updates(cells, args.work), args.repeats)
+                result.update(mode=mode, grid_x=grid, grid_y=grid, variant=variant)
+                scenarios.append(result)
+                print("{:<40} {:>10.2f} updates/s {:>14.0f} orgs/s {:>10} KB".format(
+                    name, result["updates_per_second"], result["orgs_per_second"], result["peak_rss_kb"]))
+                sys.stdout.flush()
+
+    #symbulation runs each world on one thread, so scaling is measured over concurrent independent
+    #runs, which is how replicates are run; efficiency below 1 means they compete for memory bandwidth.
+    #These times include creating the worlds, so they are comparable only with each other
+    scaling = []
+    if args.scaling_grid > 0:
+        cells = args.scaling_grid * args.scaling_grid
+        updates = num_updates(cells, args.work)
+        job_counts = [1]
+        while job_counts[-1] * 2 <= args.max_jobs:
+            job_counts.append(job_counts[-1] * 2)
+        if job_counts[-1] != args.max_jobs and args.max_jobs > 1:
+            job_counts.append(args.max_jobs)
+        for mode in bench_modes:
+            settings = dict(common_settings, GRID_X=args.scaling_grid, GRID_Y=args.scaling_grid,
+                            UPDATES=updates, DATA_INT=updates, **mode_settings[mode])
+            single = None
+            for jobs in job_counts:
+                run_dirs = [os.path.join(args.work_dir, "scaling" + str(job)) for job in range(jobs)]
+                for run_dir in run_dirs:
+                    os.makedirs(run_dir, exist_ok=True)
+                    shutil.copy(args.config_file, os.path.join(run_dir, "SymSettings.cfg"))
+                start = time.perf_counter()
+                with ThreadPoolExecutor(max_workers=jobs) as pool:
+                    futures = [pool.submit(run, executables[mode], run_dir, mode + "_scaling", settings)
+                               for run_dir in run_dirs]
+                    peak_rss = max(future.result()[1] for future in futures)
+                seconds = time.perf_counter() - start
+                total = jobs * updates / seconds
+                if single is None:
+                    single = total
+                scaling.append({"mode": mode, "grid_x": args.scaling_grid, "grid_y": args.scaling_grid,
+                                "jobs": jobs, "updates": updates, "seconds": seconds,
+                                "total_updates_per_second": total, "efficiency": total / (single * jobs),
+                                "peak_rss_kb": peak_rss})
+                print("{:<40} {:>10.2f} updates/s total, efficiency {:.2f}".format(
+                    mode + "_scaling_" + str(jobs) + "_jobs", total, total / (single * jobs)))
+                sys.stdout.flush()
+
+    with open(args.output, "w") as out:
+        json.dump({"commit": git_commit(), "date": time.strftime("%Y-%m-%dT%H:%M:%S"),
+                   "machine": {"platform": platform.platform(), "processor": platform.processor(),
+                               "cpu_count": os.cpu_count()},
+                   "work": args.work, "repeats": args.repeats,
+                   "scenarios": scenarios, "thread_scaling": scaling}, out, indent=2)
+    print("Wrote", args.output)
+
+
+if __name__ == "__main__":
+    main()